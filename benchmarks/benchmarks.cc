@@ -1,38 +1,143 @@
 #include <algorithm>
 #include <chrono>
+#include <cinttypes>
 #include <cstdio>
+#include <cstring>
 #include <mt19937.h>
 
 // Neither GCC nor Clang eliminate the function call or loops while optimising.
 // The definitions of the functions are in a shared object, and not visible to
 // the compiler.
-#define benchmark(function, iterations)  \
+#define benchmark(function, iterations, ...)  \
 {  \
-    auto delay = std::chrono::nanoseconds::max();  \
-    for(int i = 0; i < 32; ++i)  \
+    double delays[PASSES];  \
+    for(int i = 0; i < PASSES; ++i)  \
     {  \
         auto begin = std::chrono::high_resolution_clock::now();  \
         for(int long i = 0; i < iterations; ++i)  \
         {  \
-            function();  \
+            function(__VA_ARGS__);  \
         }  \
         auto end = std::chrono::high_resolution_clock::now();  \
-        auto delay_ = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);  \
-        delay = std::min(delay, delay_);  \
+        auto delay = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);  \
+        delays[i] = delay.count() / static_cast<double>(iterations);  \
     }  \
-    auto result = delay.count() / static_cast<double>(iterations);  \
-    std::printf("%20s %8.2lf ns\n", #function, result);  \
+    report(#function "(" #__VA_ARGS__ ")", delays);  \
 }
 
+static int const PASSES = 32;
+static bool json = false;
+
+/******************************************************************************
+ * Display the result of a benchmark: either the time taken by the fastest
+ * pass, or (if JSON output was requested) the times taken by all passes.
+ *
+ * @param name Name of the benchmark.
+ * @param delays Time taken per iteration in each pass in nanoseconds.
+ *****************************************************************************/
+static void report(char const *name, double const delays[])
+{
+    if(!json)
+    {
+        std::printf("%48s %12.2lf ns\n", name, *std::min_element(delays, delays + PASSES));
+        return;
+    }
+    static char const *separator = "";
+    std::printf("%s\n    {\"name\": \"%s\", \"samples\": [", separator, name);
+    for(int i = 0; i < PASSES; ++i)
+    {
+        std::printf(i == 0 ? "%.3lf" : ", %.3lf", delays[i]);
+    }
+    std::printf("]}");
+    separator = ",";
+}
+
+// Large enough to hold the largest array shuffled.
+static char items[64 * 0x10000];
+
+// Large enough to hold the largest array filled.
+static std::uint32_t words32[0x10000];
+static std::uint64_t words64[0x10000];
+
 /******************************************************************************
  * Main function.
+ *
+ * If the first argument is `--json`, the results are written in JSON format,
+ * which `results.py` can read.
  *****************************************************************************/
-int main(void)
+int main(int const argc, char const *argv[])
 {
+    json = argc >= 2 && std::strcmp(argv[1], "--json") == 0;
+    if(json)
+    {
+#if defined __clang__
+        char const *compiler = "Clang " __clang_version__;
+#elif defined __GNUC__
+        char const *compiler = "GCC " __VERSION__;
+#else
+        char const *compiler = "unknown";
+#endif
+        std::printf("{\"suite\": \"benchmarks.cc\", \"compiler\": \"%s\", \"benchmarks\": [", compiler);
+    }
+
     benchmark(mt19937::init32, 0x1000L)
     benchmark(mt19937::init64, 0x1000L)
     benchmark(mt19937::rand32, 0xFFF0L)
     benchmark(mt19937::rand64, 0xFFF0L)
     benchmark(mt19937::real32, 0xFFF0L)
     benchmark(mt19937::real64, 0xFFF0L)
+
+    // Small, power-of-two and adversarial moduli. With the last, almost half
+    // of all generated numbers are rejected.
+    benchmark(mt19937::uint32, 0xFFF0L, 6U)
+    benchmark(mt19937::uint32, 0xFFF0L, 0x100U)
+    benchmark(mt19937::uint32, 0xFFF0L, 0x80000001U)
+    benchmark(mt19937::uint64, 0xFFF0L, 6U)
+    benchmark(mt19937::uint64, 0xFFF0L, 0x100000000U)
+    benchmark(mt19937::uint64, 0xFFF0L, 0x8000000000000001U)
+
+    // Narrow and wide ranges.
+    benchmark(mt19937::span32, 0xFFF0L, -3, 3)
+    benchmark(mt19937::span32, 0xFFF0L, INT32_MIN, INT32_MAX)
+    benchmark(mt19937::span64, 0xFFF0L, -3, 3)
+    benchmark(mt19937::span64, 0xFFF0L, INT64_MIN, INT64_MAX)
+
+    // Various element sizes and array lengths.
+    benchmark(mt19937::shuf32, 0x1000L, items, 0x10, 1)
+    benchmark(mt19937::shuf32, 0x1000L, items, 0x10, 8)
+    benchmark(mt19937::shuf32, 0x1000L, items, 0x10, 64)
+    benchmark(mt19937::shuf32, 0x40L, items, 0x400, 1)
+    benchmark(mt19937::shuf32, 0x40L, items, 0x400, 8)
+    benchmark(mt19937::shuf32, 0x40L, items, 0x400, 64)
+    benchmark(mt19937::shuf32, 0x2L, items, 0x10000, 1)
+    benchmark(mt19937::shuf32, 0x2L, items, 0x10000, 8)
+    benchmark(mt19937::shuf32, 0x2L, items, 0x10000, 64)
+    benchmark(mt19937::shuf64, 0x40L, items, 0x400, 8)
+
+    // Fewer and more steps than the state length.
+    benchmark(mt19937::drop32, 0x1000L, 1)
+    benchmark(mt19937::drop32, 0x400L, 624)
+    benchmark(mt19937::drop32, 0x10L, 0x10000)
+    benchmark(mt19937::drop64, 0x1000L, 1)
+    benchmark(mt19937::drop64, 0x400L, 312)
+    benchmark(mt19937::drop64, 0x10L, 0x10000)
+    benchmark(mt19937::back32, 0x1000L, 1)
+    benchmark(mt19937::back32, 0x400L, 624)
+    benchmark(mt19937::back32, 0x10L, 0x10000)
+    benchmark(mt19937::back64, 0x1000L, 1)
+    benchmark(mt19937::back64, 0x400L, 312)
+    benchmark(mt19937::back64, 0x10L, 0x10000)
+
+    // Fewer and more numbers than the state length.
+    benchmark(mt19937::fill32, 0x1000L, words32, 1)
+    benchmark(mt19937::fill32, 0x400L, words32, 624)
+    benchmark(mt19937::fill32, 0x10L, words32, 0x10000)
+    benchmark(mt19937::fill64, 0x1000L, words64, 1)
+    benchmark(mt19937::fill64, 0x400L, words64, 312)
+    benchmark(mt19937::fill64, 0x10L, words64, 0x10000)
+
+    if(json)
+    {
+        std::printf("\n]}\n");
+    }
 }
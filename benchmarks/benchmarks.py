@@ -1,28 +1,135 @@
 #! /usr/bin/env python3
 
-import math
+import json
 import mt19937
+import platform
+import random
+import secrets
+import sys
 import time
 import timeit
 
+results = None
+overhead = 0
+timed = set()
+
+
+def shuffle(items):
+    """
+Shuffle a list in place using the Fisher-Yates algorithm. (The Python API has no function to shuffle lists.)
+
+:param items: List to shuffle.
+    """
+    for i in range(len(items) - 1, 0, -1):
+        j = mt19937.uint32(i + 1)
+        items[i], items[j] = items[j], items[i]
+
+
+namespace = {
+    **vars(mt19937),
+    'random': random,
+    'secrets': secrets,
+    'shuffle': shuffle,
+    'sys': sys,
+    'items16': list(range(0x10)),
+    'items1024': list(range(0x400)),
+    'items65536': list(range(0x10000)),
+}
+
 
 def benchmark(stmt, number, passes=32):
-    delay = math.inf
+    """
+Time a statement. Display the time taken per run (both including and excluding the overhead of calling a C function
+from Python), or save all times if JSON output was requested.
+
+:param stmt: Statement to time.
+:param number: Number of times to run the statement in each pass.
+:param passes: Number of passes.
+
+:return: Time taken per run in the fastest pass in nanoseconds (``None`` if the statement was timed before).
+    """
+    # Statements which appear in several comparisons are timed only once.
+    if stmt in timed:
+        return None
+    timed.add(stmt)
+    delays = []
     for _ in range(passes):
-        delay_ = timeit.timeit(stmt=stmt, number=number, timer=time.perf_counter_ns)
-        delay = min(delay, delay_)
-    result = delay / number
-    print(f'{stmt.__name__:>20} {result:8.2f} ns')
+        delay = timeit.timeit(stmt=stmt, number=number, timer=time.perf_counter_ns, globals=namespace)
+        delays.append(delay / number)
+    if results is None:
+        print(f'{stmt:>48} {min(delays):12.2f} ns {min(delays) - overhead:12.2f} ns')
+    else:
+        results.append({'name': stmt, 'samples': delays})
+    return min(delays)
 
 
 def main():
-    """Main function."""
-    benchmark(mt19937.init32, 0x1000)
-    benchmark(mt19937.init64, 0x1000)
-    benchmark(mt19937.rand32, 0xFFF0)
-    benchmark(mt19937.rand64, 0xFFF0)
-    benchmark(mt19937.real32, 0xFFF0)
-    benchmark(mt19937.real64, 0xFFF0)
+    """
+Main function. If the first argument is ``--json``, the results are written in JSON format, which ``results.py`` can
+read.
+    """
+    global results, overhead
+    if sys.argv[1:2] == ['--json']:
+        results = []
+    else:
+        print(f'{"":>48} {"total":>15} {"less overhead":>15}')
+
+    # A C function which does almost nothing (it returns a stored integer).
+    # Calling it from Python takes about as long as calling an empty C function
+    # does, which is the least any of the functions below can take.
+    overhead = benchmark('sys.getrecursionlimit()', 0xFFF0)
+
+    benchmark('init32()', 0x1000)
+    benchmark('init64()', 0x1000)
+    benchmark('random.seed()', 0x1000)
+
+    benchmark('rand32()', 0xFFF0)
+    benchmark('random.getrandbits(32)', 0xFFF0)
+    benchmark('secrets.randbits(32)', 0xFFF0)
+    benchmark('rand64()', 0xFFF0)
+    benchmark('random.getrandbits(64)', 0xFFF0)
+    benchmark('secrets.randbits(64)', 0xFFF0)
+
+    benchmark('real32()', 0xFFF0)
+    benchmark('real64()', 0xFFF0)
+    benchmark('random.random()', 0xFFF0)
+
+    # Small, power-of-two and adversarial moduli. With the last, almost half of
+    # all generated numbers are rejected.
+    for modulus in ('6', '0x100', '0x80000001'):
+        benchmark(f'uint32({modulus})', 0xFFF0)
+        benchmark(f'random.randrange({modulus})', 0xFFF0)
+        benchmark(f'secrets.randbelow({modulus})', 0xFFF0)
+    for modulus in ('6', '0x100000000', '0x8000000000000001'):
+        benchmark(f'uint64({modulus})', 0xFFF0)
+        benchmark(f'random.randrange({modulus})', 0xFFF0)
+        benchmark(f'secrets.randbelow({modulus})', 0xFFF0)
+
+    # Narrow and wide ranges.
+    for left, right in (('-3', '3'), ('-0x80000000', '0x7FFFFFFF')):
+        benchmark(f'span32({left}, {right})', 0xFFF0)
+        benchmark(f'random.randrange({left}, {right})', 0xFFF0)
+    for left, right in (('-3', '3'), ('-0x8000000000000000', '0x7FFFFFFFFFFFFFFF')):
+        benchmark(f'span64({left}, {right})', 0xFFF0)
+        benchmark(f'random.randrange({left}, {right})', 0xFFF0)
+
+    # Lists of various lengths.
+    for items, number in (('items16', 0x1000), ('items1024', 0x40), ('items65536', 0x2)):
+        benchmark(f'shuffle({items})', number)
+        benchmark(f'random.shuffle({items})', number)
+
+    # Fewer and more steps than the state length.
+    for count, number in (('1', 0x1000), ('624', 0x400), ('0x10000', 0x10)):
+        benchmark(f'drop32({count})', number)
+        benchmark(f'back32({count})', number)
+    for count, number in (('1', 0x1000), ('312', 0x400), ('0x10000', 0x10)):
+        benchmark(f'drop64({count})', number)
+        benchmark(f'back64({count})', number)
+
+    if results is not None:
+        compiler = f'{platform.python_implementation()} {platform.python_version()} ({platform.python_compiler()})'
+        json.dump({'suite': 'benchmarks.py', 'compiler': compiler, 'benchmarks': results}, sys.stdout, indent=4)
+        print()
 
 
 if __name__ == '__main__':
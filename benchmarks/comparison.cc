@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <mt19937.h>
+#include <random>
+
+#include "reference/reference.h"
+
+// When everything is compiled with link-time optimisation, the generators may
+// be inlined into the benchmarking loop. Accumulate the generated numbers and
+// store the result, so that the compiler cannot discard them.
+static std::uint64_t volatile sink;
+
+template<typename Generator>
+void benchmark(char const *name, Generator generator, int long iterations)
+{
+    auto delay = std::chrono::nanoseconds::max();
+    for(int i = 0; i < 32; ++i)
+    {
+        std::uint64_t accumulator = 0;
+        auto begin = std::chrono::high_resolution_clock::now();
+        for(int long j = 0; j < iterations; ++j)
+        {
+            accumulator ^= generator();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        sink = accumulator;
+        auto delay_ = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
+        delay = std::min(delay, delay_);
+    }
+    auto result = delay.count() / static_cast<double>(iterations);
+    std::printf("%20s %8.2lf ns\n", name, result);
+}
+
+/******************************************************************************
+ * Check that a generator seeded with 5489 produces the value required by the
+ * C++ standard on its 10000th invocation. Otherwise, the comparison would be
+ * meaningless.
+ *
+ * @param name Name of the generator.
+ * @param generator Generator to check.
+ * @param expected Value to produce.
+ *****************************************************************************/
+template<typename Generator>
+void verify(char const *name, Generator generator, std::uint64_t expected)
+{
+    for(int i = 1; i < 10000; ++i)
+    {
+        generator();
+    }
+    std::uint64_t actual = generator();
+    if(actual != expected)
+    {
+        std::fprintf(stderr, "%s produced %" PRIu64 " instead of %" PRIu64 ".\n", name, actual, expected);
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+/******************************************************************************
+ * Main function.
+ *****************************************************************************/
+int main(void)
+{
+    mt19937_32_t mt32;
+    mt19937_64_t mt64;
+    std::mt19937 std_mt32;
+    std::mt19937_64 std_mt64;
+    init_genrand(5489);
+    larsen_seed(5489);
+
+    auto mt19937_rand32 = [] { return mt19937::rand32(); };
+    auto mt19937_32_t_rand32 = [&] { return mt32.rand32(); };
+    auto std_mt19937 = [&] { return std_mt32(); };
+    auto reference_genrand_int32 = [] { return genrand_int32(); };
+    auto larsen_rand_u32 = [] { return ::larsen_rand_u32(); };
+    auto mt19937_rand64 = [] { return mt19937::rand64(); };
+    auto mt19937_64_t_rand64 = [&] { return mt64.rand64(); };
+    auto std_mt19937_64 = [&] { return std_mt64(); };
+
+    verify("mt19937::rand32", mt19937_rand32, 4123659995U);
+    verify("mt19937_32_t::rand32", mt19937_32_t_rand32, 4123659995U);
+    verify("std::mt19937", std_mt19937, 4123659995U);
+    verify("genrand_int32", reference_genrand_int32, 4123659995U);
+    verify("larsen_rand_u32", larsen_rand_u32, 4123659995U);
+    verify("mt19937::rand64", mt19937_rand64, 9981545732273789042U);
+    verify("mt19937_64_t::rand64", mt19937_64_t_rand64, 9981545732273789042U);
+    verify("std::mt19937_64", std_mt19937_64, 9981545732273789042U);
+
+    benchmark("mt19937::rand32", mt19937_rand32, 0xFFF0L);
+    benchmark("mt19937_32_t::rand32", mt19937_32_t_rand32, 0xFFF0L);
+    benchmark("std::mt19937", std_mt19937, 0xFFF0L);
+    benchmark("genrand_int32", reference_genrand_int32, 0xFFF0L);
+    benchmark("larsen_rand_u32", larsen_rand_u32, 0xFFF0L);
+    benchmark("mt19937::rand64", mt19937_rand64, 0xFFF0L);
+    benchmark("mt19937_64_t::rand64", mt19937_64_t_rand64, 0xFFF0L);
+    benchmark("std::mt19937_64", std_mt19937_64, 0xFFF0L);
+}
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <mt19937.h>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+static std::uint64_t volatile sink;
+
+/******************************************************************************
+ * Counter of last-level cache misses incurred by this thread in user mode.
+ * Unavailable on platforms other than Linux, and wherever the kernel does not
+ * permit it (see `/proc/sys/kernel/perf_event_paranoid`).
+ *****************************************************************************/
+class CacheMisses
+{
+    int fd;
+
+    public:
+    CacheMisses(void) : fd(-1)
+    {
+#ifdef __linux__
+        perf_event_attr attr = {};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof attr;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    }
+
+    ~CacheMisses(void)
+    {
+#ifdef __linux__
+        if(fd >= 0)
+        {
+            close(fd);
+        }
+#endif
+    }
+
+    bool available(void) const
+    {
+        return fd >= 0;
+    }
+
+    void start(void)
+    {
+#ifdef __linux__
+        if(fd >= 0)
+        {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    std::uint64_t stop(void)
+    {
+        std::uint64_t count = 0;
+#ifdef __linux__
+        if(fd >= 0)
+        {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            if(read(fd, &count, sizeof count) != sizeof count)
+            {
+                count = 0;
+            }
+        }
+#endif
+        return count;
+    }
+};
+
+/******************************************************************************
+ * Draw from many MT19937 objects, visiting them in the given order in each
+ * round. The first round is not timed.
+ *
+ * @param objects MT19937 objects.
+ * @param order Indices of the objects, in the order in which to visit them.
+ * @param rounds Number of timed rounds.
+ * @param misses Cache miss counter.
+ * @param name Description of the order.
+ *****************************************************************************/
+static void benchmark(std::vector<mt19937_32_t>& objects, std::vector<std::uint32_t> const& order, int long rounds,
+    CacheMisses& misses, char const *name)
+{
+    std::uint64_t accumulator = 0;
+    for(std::uint32_t i : order)
+    {
+        accumulator ^= objects[i].rand32();
+    }
+    auto begin = std::chrono::steady_clock::now();
+    misses.start();
+    for(int long r = 0; r < rounds; ++r)
+    {
+        for(std::uint32_t i : order)
+        {
+            accumulator ^= objects[i].rand32();
+        }
+    }
+    std::uint64_t count = misses.stop();
+    auto end = std::chrono::steady_clock::now();
+    sink = accumulator;
+
+    double draws = static_cast<double>(rounds) * order.size();
+    auto delay = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    std::printf("%10zu %10.1lf MiB %12s %8.2lf ns", objects.size(), objects.size() * sizeof objects[0] / 1048576.0,
+        name, delay / draws);
+    if(misses.available())
+    {
+        std::printf(" %10.3lf\n", count / draws);
+    }
+    else
+    {
+        std::printf(" %10s\n", "n/a");
+    }
+}
+
+/******************************************************************************
+ * Main function.
+ *
+ * The maximum number of objects may be specified as the first argument. By
+ * default, it is 1000000, but numbers of objects which would occupy more than
+ * half of the physical memory are skipped.
+ *****************************************************************************/
+int main(int const argc, char const *argv[])
+{
+    std::size_t max_objects = argc >= 2 ? std::strtoull(argv[1], NULL, 10) : 1000000;
+    std::size_t max_bytes = SIZE_MAX;
+#ifdef __linux__
+    max_bytes = static_cast<std::size_t>(sysconf(_SC_PHYS_PAGES)) * sysconf(_SC_PAGESIZE) / 2;
+#endif
+
+    CacheMisses misses;
+    std::mt19937 engine;
+    std::printf("%10s %14s %12s %11s %10s\n", "objects", "memory", "order", "per draw", "LLC misses");
+    // Numbers of objects go 1, 2, 5, 10, 20, 50, ….
+    for(std::size_t k = 1, step = 0; k <= max_objects; k = step++ % 3 == 1 ? k * 5 / 2 : k * 2)
+    {
+        if(k > max_bytes / sizeof(mt19937_32_t))
+        {
+            std::printf("%10zu objects would not fit in memory.\n", k);
+            break;
+        }
+
+        // Seed the objects differently and advance them by different amounts,
+        // so that they don't all twist in the same round.
+        std::vector<mt19937_32_t> objects(k);
+        for(std::size_t i = 0; i < k; ++i)
+        {
+            objects[i].seed32(i);
+            objects[i].drop32(engine() % 624);
+        }
+
+        int long rounds = std::max<int long>(1, (1L << 22) / k);
+        std::vector<std::uint32_t> order(k);
+        std::iota(order.begin(), order.end(), 0);
+        benchmark(objects, order, rounds, misses, "round-robin");
+        std::shuffle(order.begin(), order.end(), engine);
+        benchmark(objects, order, rounds, misses, "random");
+    }
+}
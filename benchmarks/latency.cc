@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <mt19937.h>
+#include <thread>
+#include <vector>
+
+#if defined __x86_64__ || defined __i386__
+#include <x86intrin.h>
+
+// `rdtscp` waits until all previous instructions have executed, and `lfence`
+// prevents later instructions from beginning execution before it.
+static inline std::uint64_t timestamp(void)
+{
+    unsigned aux;
+    std::uint64_t ticks = __rdtscp(&aux);
+    _mm_lfence();
+    return ticks;
+}
+#else
+static inline std::uint64_t timestamp(void)
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+#endif
+
+static std::uint64_t volatile sink;
+
+/******************************************************************************
+ * Histogram with logarithmically-spaced buckets, each of which is linearly
+ * subdivided, in the manner of an HDR histogram. Values below 64 are recorded
+ * exactly; larger values are recorded with a relative error below 1/32.
+ *****************************************************************************/
+class Histogram
+{
+    static int const SUB_BUCKET_BITS = 5;
+    static int const SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    std::vector<std::uint64_t> counts;
+    std::uint64_t total, max;
+
+    static int index_of(std::uint64_t value)
+    {
+        if(value < 2 * SUB_BUCKETS)
+        {
+            return value;
+        }
+        int magnitude = 0;
+        while(value >> magnitude >= 2 * SUB_BUCKETS)
+        {
+            ++magnitude;
+        }
+        return magnitude * SUB_BUCKETS + (value >> magnitude);
+    }
+
+    static std::uint64_t value_of(int index)
+    {
+        if(index < 2 * SUB_BUCKETS)
+        {
+            return index;
+        }
+        int magnitude = index / SUB_BUCKETS - 1;
+        return static_cast<std::uint64_t>(index - magnitude * SUB_BUCKETS) << magnitude;
+    }
+
+    public:
+    Histogram(void) : counts((64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS), total(0), max(0) {}
+
+    void record(std::uint64_t value)
+    {
+        ++counts[index_of(value)];
+        ++total;
+        max = std::max(max, value);
+    }
+
+    std::uint64_t count(void) const
+    {
+        return total;
+    }
+
+    std::uint64_t maximum(void) const
+    {
+        return max;
+    }
+
+    /**************************************************************************
+     * Find the smallest recorded value (up to the resolution of the
+     * histogram) which is not less than the given fraction of all recorded
+     * values.
+     *
+     * @param fraction Number from 0 to 1.
+     *
+     * @return Percentile.
+     *************************************************************************/
+    std::uint64_t percentile(double fraction) const
+    {
+        std::uint64_t rank = fraction * total;
+        std::uint64_t cumulative = 0;
+        for(std::size_t i = 0; i < counts.size(); ++i)
+        {
+            cumulative += counts[i];
+            if(cumulative > rank)
+            {
+                return std::min(value_of(i), max);
+            }
+        }
+        return max;
+    }
+};
+
+/******************************************************************************
+ * Estimate the number of timestamp ticks per nanosecond.
+ *
+ * @return Ticks per nanosecond.
+ *****************************************************************************/
+static double ticks_per_nanosecond(void)
+{
+    auto begin = std::chrono::steady_clock::now();
+    std::uint64_t begin_ticks = timestamp();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    auto end = std::chrono::steady_clock::now();
+    std::uint64_t end_ticks = timestamp();
+    auto delay = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
+    return (end_ticks - begin_ticks) / static_cast<double>(delay.count());
+}
+
+/******************************************************************************
+ * Estimate the number of timestamp ticks taken to obtain two consecutive
+ * timestamps. This is subtracted from every measurement.
+ *
+ * @return Ticks.
+ *****************************************************************************/
+static std::uint64_t overhead(void)
+{
+    std::uint64_t ticks = UINT64_MAX;
+    for(int i = 0; i < 0x10000; ++i)
+    {
+        std::uint64_t begin = timestamp();
+        std::uint64_t end = timestamp();
+        ticks = std::min(ticks, end - begin);
+    }
+    return ticks;
+}
+
+static void report(char const *name, Histogram const& histogram, double scale)
+{
+    std::printf(
+        "%20s %10" PRIu64 " %8.2lf %8.2lf %8.2lf %10.2lf ns\n", name, histogram.count(),
+        histogram.percentile(0.5) / scale, histogram.percentile(0.99) / scale, histogram.percentile(0.999) / scale,
+        histogram.maximum() / scale
+    );
+}
+
+/******************************************************************************
+ * Time each of many calls of a function individually. Calls during which the
+ * twist branch of `MT19937_RAND` was taken (i.e. the state index wrapped
+ * around) are also recorded separately.
+ *
+ * @param name Name of the function.
+ * @param function Function to call.
+ * @param index State index of the MT19937 object used by `function`. (The
+ *     members of MT19937 objects are private, but peeking at it is the only
+ *     way to tell when the state was twisted.)
+ * @param calls Number of calls.
+ * @param ticks Overhead of timing, in ticks.
+ * @param scale Ticks per nanosecond.
+ *****************************************************************************/
+template<typename Function>
+void benchmark(char const *name, Function function, int const& index, int long calls, std::uint64_t ticks, double scale)
+{
+    Histogram all, twist, other;
+    for(int long i = 0; i < calls; ++i)
+    {
+        int index_ = index;
+        std::uint64_t begin = timestamp();
+        sink = function();
+        std::uint64_t end = timestamp();
+        std::uint64_t delay = end - begin;
+        delay = delay > ticks ? delay - ticks : 0;
+        all.record(delay);
+        (index < index_ ? twist : other).record(delay);
+    }
+    report(name, all, scale);
+    report("(twist)", twist, scale);
+    report("(no twist)", other, scale);
+}
+
+/******************************************************************************
+ * Main function.
+ *****************************************************************************/
+int main(void)
+{
+    double scale = ticks_per_nanosecond();
+    std::uint64_t ticks = overhead();
+    std::printf("Timing overhead of %" PRIu64 " ticks (%.2lf ticks/ns) subtracted.\n", ticks, scale);
+    std::printf("%20s %10s %8s %8s %8s %10s\n", "", "calls", "p50", "p99", "p99.9", "max");
+
+    mt19937_32_t mt32;
+    mt19937_64_t mt64;
+    int long calls = 624L * 2048;
+    benchmark("rand32", [&] { return mt32.rand32(); }, mt32.index, calls, ticks, scale);
+    benchmark("rand64", [&] { return mt64.rand64(); }, mt64.index, calls, ticks, scale);
+    benchmark("uint32", [&] { return mt32.uint32(1000); }, mt32.index, calls, ticks, scale);
+    benchmark("real64", [&] { return mt64.real64(); }, mt64.index, calls, ticks, scale);
+}
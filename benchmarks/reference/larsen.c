@@ -0,0 +1,96 @@
+/*
+ * C. S. Larsen's fast Mersenne Twister, translated from C++ to C. The
+ * structure of the original (split twist loop, branch-free selection of
+ * the twist constant and a separate array of tempered values) has been
+ * preserved. The functions are renamed to avoid collisions.
+ *
+ * Copyright (C) 2015, 2017 Christian Stigen Larsen
+ * https://github.com/cslarsen/mersenne-twister
+ */
+
+#include <stddef.h>
+
+#include "reference.h"
+
+static const size_t SIZE = 624;
+static const size_t PERIOD = 397;
+static const size_t DIFF = 624 - 397;
+
+static const uint32_t MAGIC = 0x9908b0df;
+
+// State for a singleton Mersenne Twister.
+static struct MTState
+{
+    uint32_t MT[624];
+    uint32_t MT_TEMPERED[624];
+    size_t index;
+} state = {{0}, {0}, 624};
+
+#define M32(x) (0x80000000 & x) // 32nd MSB
+#define L31(x) (0x7FFFFFFF & x) // 31 LSBs
+
+#define UNROLL(expr) \
+  y = M32(state.MT[i]) | L31(state.MT[i+1]); \
+  state.MT[i] = state.MT[expr] ^ (y >> 1) ^ ((uint32_t)((int32_t)(y << 31) >> 31) & MAGIC); \
+  ++i;
+
+static void generate_numbers(void)
+{
+  // Splitting the loop in two eliminates modulo operations.
+
+  size_t i = 0;
+  uint32_t y;
+
+  // i = [0 ... 226]
+  while ( i < DIFF ) {
+    UNROLL(i+PERIOD);
+  }
+
+  // i = [227 ... 622]
+  while ( i < SIZE -1 ) {
+    UNROLL(i-DIFF);
+  }
+
+  {
+    // i = 623, last step rolls over
+    y = M32(state.MT[SIZE-1]) | L31(state.MT[0]);
+    state.MT[SIZE-1] = state.MT[PERIOD-1] ^ (y >> 1) ^ ((uint32_t)((int32_t)(y << 31) >> 31) & MAGIC);
+  }
+
+  // Temper all numbers in a batch
+  for (size_t i = 0; i < SIZE; ++i) {
+    y = state.MT[i];
+    y ^= y >> 11;
+    y ^= y << 7  & 0x9d2c5680;
+    y ^= y << 15 & 0xefc60000;
+    y ^= y >> 18;
+    state.MT_TEMPERED[i] = y;
+  }
+
+  state.index = 0;
+}
+
+void larsen_seed(uint32_t value)
+{
+  /*
+   * A linear congruential generator with the Borosh-Niederreiter multiplier
+   * fills the state. Since the state is made of 32-bit words, there is no need
+   * to mask the result with 0xFFFFFFFF.
+   */
+
+  state.MT[0] = value;
+  state.index = SIZE;
+
+  for ( uint32_t i=1; i<SIZE; ++i )
+    state.MT[i] = 0x6c078965*(state.MT[i-1] ^ state.MT[i-1]>>30) + i;
+}
+
+uint32_t larsen_rand_u32(void)
+{
+  if ( state.index == SIZE ) {
+    generate_numbers();
+    state.index = 0;
+  }
+
+  return state.MT_TEMPERED[state.index++];
+}
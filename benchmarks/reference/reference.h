@@ -0,0 +1,24 @@
+#ifndef TFPF_MERSENNE_TWISTER_BENCHMARKS_REFERENCE_REFERENCE_H_
+#define TFPF_MERSENNE_TWISTER_BENCHMARKS_REFERENCE_REFERENCE_H_
+
+#ifdef __cplusplus
+#include <cinttypes>
+extern "C"
+{
+#else
+#include <inttypes.h>
+#endif
+
+// M. Matsumoto and T. Nishimura's reference implementation.
+void init_genrand(unsigned long s);
+unsigned long genrand_int32(void);
+
+// C. S. Larsen's implementation.
+void larsen_seed(uint32_t value);
+uint32_t larsen_rand_u32(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // TFPF_MERSENNE_TWISTER_BENCHMARKS_REFERENCE_REFERENCE_H_
@@ -0,0 +1,196 @@
+#! /usr/bin/env python3
+
+"""
+Store the results of benchmark runs, and compare any two of them.
+    ./benchmarks --json | python3 results.py save
+    ./benchmarks.py --json | python3 results.py save
+    python3 results.py list
+    python3 results.py compare OLD NEW
+Each run is saved in the directory 'results', under a name made of the git revision, the CPU model, the compiler and the
+benchmark suite. OLD and NEW may be any such names (or the paths of the corresponding files).
+"""
+
+
+import argparse
+import datetime
+import json
+import math
+import os
+import os.path
+import platform
+import re
+import statistics
+import subprocess
+import sys
+
+directory = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'results')
+
+
+def git_revision():
+    """
+Find the git revision of the working tree, marking it if it has uncommitted changes.
+
+:return: Abbreviated commit hash.
+    """
+    try:
+        revision = subprocess.check_output(
+            ('git', 'rev-parse', '--short', 'HEAD'), stderr=subprocess.DEVNULL, text=True
+        ).strip()
+        status = subprocess.check_output(('git', 'status', '--porcelain', '--untracked-files=no'), text=True)
+    except (OSError, subprocess.CalledProcessError):
+        return 'unknown'
+    return revision + '-dirty' if status else revision
+
+
+def cpu_model():
+    """
+Find the model name of the CPU.
+
+:return: Model name.
+    """
+    try:
+        with open('/proc/cpuinfo') as reader:
+            for line in reader:
+                key, _, value = line.partition(':')
+                if key.strip() == 'model name':
+                    return value.strip()
+    except OSError:
+        pass
+    return platform.processor() or platform.machine() or 'unknown'
+
+
+def slug(text):
+    """
+Convert text into something which can be used in a file name.
+
+:param text: Text.
+
+:return: Text with runs of characters other than letters, digits, dots and hyphens replaced with hyphens.
+    """
+    return re.sub(r'[^A-Za-z0-9.]+', '-', text).strip('-')
+
+
+def load(name):
+    """
+Read a stored run.
+
+:param name: Name of the run or path of its file.
+
+:return: Stored run.
+    """
+    fname = name if os.path.isfile(name) else os.path.join(directory, f'{name}.json')
+    with open(fname) as reader:
+        return json.load(reader)
+
+
+def mann_whitney(old, new):
+    """
+One-sided Mann-Whitney U test of whether the values in ``new`` tend to be larger than those in ``old``. The normal
+approximation (with a tie correction and a continuity correction) is used, which is adequate for the 32 samples the
+benchmarks collect.
+
+:param old: Samples.
+:param new: Samples.
+
+:return: p-value.
+    """
+    n1, n2 = len(old), len(new)
+    combined = sorted([(value, 0) for value in old] + [(value, 1) for value in new])
+    ranks = [0.0] * len(combined)
+    ties = 0
+    i = 0
+    while i < len(combined):
+        j = i
+        while j + 1 < len(combined) and combined[j + 1][0] == combined[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2 + 1
+        ties += (j - i + 1) ** 3 - (j - i + 1)
+        i = j + 1
+
+    # Number of pairs in which the new sample is larger than the old sample.
+    rank_sum = sum(rank for rank, (_, group) in zip(ranks, combined) if group == 1)
+    u = rank_sum - n2 * (n2 + 1) / 2
+    n = n1 + n2
+    variance = n1 * n2 / 12 * (n + 1 - ties / (n * (n - 1)))
+    if variance == 0:
+        return 1.0
+    z = (u - n1 * n2 / 2 - 0.5) / math.sqrt(variance)
+    return math.erfc(z / math.sqrt(2)) / 2
+
+
+def save(args):
+    run = json.load(sys.stdin if args.file == '-' else open(args.file))
+    run['revision'] = args.revision or git_revision()
+    run['cpu'] = cpu_model()
+    run['date'] = datetime.datetime.now().isoformat(timespec='seconds')
+    name = '_'.join(slug(run[key]) for key in ('revision', 'cpu', 'compiler', 'suite'))
+    os.makedirs(directory, exist_ok=True)
+    with open(os.path.join(directory, f'{name}.json'), 'w') as writer:
+        json.dump(run, writer, indent=4)
+    print(name)
+
+
+def list_(args):
+    if not os.path.isdir(directory):
+        return
+    for fname in sorted(os.listdir(directory), key=lambda fname: os.path.getmtime(os.path.join(directory, fname))):
+        if fname.endswith('.json'):
+            print(fname[:-5])
+
+
+def compare(args):
+    old, new = load(args.old), load(args.new)
+    if old['suite'] != new['suite']:
+        raise SystemExit(f'Cannot compare runs of {old["suite"]} and {new["suite"]}.')
+    for key in ('cpu', 'compiler'):
+        if old.get(key) != new.get(key):
+            print(f'Warning: the runs have different {key}s.', file=sys.stderr)
+
+    old_benchmarks = {benchmark['name']: benchmark['samples'] for benchmark in old['benchmarks']}
+    regressions = 0
+    print(f'{"":>48} {"old":>12} {"new":>12} {"change":>8} {"p-value":>8}')
+    for benchmark in new['benchmarks']:
+        name, new_samples = benchmark['name'], benchmark['samples']
+        old_samples = old_benchmarks.get(name)
+        if old_samples is None:
+            continue
+        old_median, new_median = statistics.median(old_samples), statistics.median(new_samples)
+        change = (new_median - old_median) / old_median * 100
+        p = mann_whitney(old_samples, new_samples)
+        regressed = p < args.alpha and change > args.threshold
+        regressions += regressed
+        flag = ' regression' if regressed else ''
+        print(f'{name:>48} {old_median:9.2f} ns {new_median:9.2f} ns {change:7.1f}% {p:8.4f}{flag}')
+    if regressions > 0:
+        raise SystemExit(f'{regressions} significant regression(s) above {args.threshold}%.')
+
+
+def main():
+    """Main function."""
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    subparsers = parser.add_subparsers(required=True)
+
+    parser_save = subparsers.add_parser('save', help='store the JSON output of a benchmark run')
+    parser_save.add_argument('file', nargs='?', default='-', help='file to read the run from (default: standard input)')
+    parser_save.add_argument('--revision', help='revision to record instead of that of the working tree')
+    parser_save.set_defaults(function=save)
+
+    parser_list = subparsers.add_parser('list', help='list stored runs, oldest first')
+    parser_list.set_defaults(function=list_)
+
+    parser_compare = subparsers.add_parser('compare', help='compare two stored runs')
+    parser_compare.add_argument('old')
+    parser_compare.add_argument('new')
+    parser_compare.add_argument('--alpha', type=float, default=0.01, help='significance level (default: 0.01)')
+    parser_compare.add_argument(
+        '--threshold', type=float, default=5, help='smallest slowdown of the median in per cent to flag (default: 5)'
+    )
+    parser_compare.set_defaults(function=compare)
+
+    args = parser.parse_args()
+    args.function(args)
+
+
+if __name__ == '__main__':
+    main()
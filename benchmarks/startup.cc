@@ -0,0 +1,248 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <mt19937.h>
+#include <string>
+#include <vector>
+
+#include <dlfcn.h>
+#include <link.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+typedef std::chrono::steady_clock Clock;
+
+static double nanoseconds(Clock::time_point begin, Clock::time_point end)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+}
+
+// Dynamic initialisation of objects defined in the same translation unit
+// happens in the order of their definitions. Hence, this measures the cost of
+// constructing a seeded global MT19937 object at start-up.
+static Clock::time_point const static_begin = Clock::now();
+static mt19937_32_t seeded_global(5489);
+static Clock::time_point const static_end = Clock::now();
+
+enum
+{
+    STATIC_INIT, FIRST_RAND, INIT, DLOPEN, MEASUREMENTS,
+};
+static char const *names[] =
+{
+    "seeded object construction", "first rand32 after seeding", "init32", "dlopen and dlsym",
+};
+
+/******************************************************************************
+ * Load the library and look up a function in it.
+ *
+ * @param library Path of the library. This must not be the copy this program
+ *     is linked against, or else `dlopen` will not actually load anything.
+ *
+ * @return Time taken in nanoseconds.
+ *****************************************************************************/
+static double load(char const *library)
+{
+    auto begin = Clock::now();
+    void *handle = dlopen(library, RTLD_NOW | RTLD_LOCAL);
+    void *symbol = handle == NULL ? NULL : dlsym(handle, "mt19937_rand32");
+    auto end = Clock::now();
+    if(symbol == NULL)
+    {
+        std::fprintf(stderr, "Could not load %s.\n", library);
+        std::exit(EXIT_FAILURE);
+    }
+    dlclose(handle);
+    return nanoseconds(begin, end);
+}
+
+/******************************************************************************
+ * Measure start-up costs in this process, which was started only to do so.
+ *
+ * @param library Path of the library to load.
+ * @param results Array to store the times taken in nanoseconds in.
+ *****************************************************************************/
+static void measure_fresh(char const *library, double results[])
+{
+    results[STATIC_INIT] = nanoseconds(static_begin, static_end);
+
+    auto begin = Clock::now();
+    seeded_global.rand32();
+    auto end = Clock::now();
+    results[FIRST_RAND] = nanoseconds(begin, end);
+
+    mt19937_32_t mt;
+    begin = Clock::now();
+    mt.init32();
+    end = Clock::now();
+    results[INIT] = nanoseconds(begin, end);
+
+    results[DLOPEN] = load(library);
+}
+
+/******************************************************************************
+ * Measure the same costs again in a process in which everything has already
+ * been done at least once.
+ *
+ * @param library Path of the library to load.
+ * @param results Array to store the times taken in nanoseconds in.
+ *****************************************************************************/
+static void measure_warm(char const *library, double results[])
+{
+    auto begin = Clock::now();
+    mt19937_32_t mt(5489);
+    auto end = Clock::now();
+    results[STATIC_INIT] = nanoseconds(begin, end);
+
+    begin = Clock::now();
+    mt.rand32();
+    end = Clock::now();
+    results[FIRST_RAND] = nanoseconds(begin, end);
+
+    begin = Clock::now();
+    mt.init32();
+    end = Clock::now();
+    results[INIT] = nanoseconds(begin, end);
+
+    results[DLOPEN] = load(library);
+}
+
+static int find_library(dl_phdr_info *info, std::size_t, void *data)
+{
+    if(std::strstr(info->dlpi_name, "mt19937") != NULL)
+    {
+        *static_cast<std::string *>(data) = info->dlpi_name;
+        return 1;
+    }
+    return 0;
+}
+
+/******************************************************************************
+ * Run this program in a fresh process to measure start-up costs there.
+ *
+ * @param program Path of this program.
+ * @param library Path of the library to load.
+ * @param results Array to store the times taken in nanoseconds in.
+ *****************************************************************************/
+static void spawn(char const *program, char const *library, double results[])
+{
+    int fds[2];
+    if(pipe(fds) != 0)
+    {
+        std::perror("pipe");
+        std::exit(EXIT_FAILURE);
+    }
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+    posix_spawn_file_actions_addclose(&actions, fds[0]);
+    char const *argv[] = {program, "--fresh", library, NULL};
+    pid_t pid;
+    if(posix_spawn(&pid, program, &actions, NULL, const_cast<char **>(argv), environ) != 0)
+    {
+        std::perror("posix_spawn");
+        std::exit(EXIT_FAILURE);
+    }
+    posix_spawn_file_actions_destroy(&actions);
+    close(fds[1]);
+
+    FILE *reader = fdopen(fds[0], "r");
+    for(int i = 0; i < MEASUREMENTS; ++i)
+    {
+        if(std::fscanf(reader, "%lf", &results[i]) != 1)
+        {
+            std::fprintf(stderr, "Could not read the results of the fresh process.\n");
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    std::fclose(reader);
+    waitpid(pid, NULL, 0);
+}
+
+static double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+/******************************************************************************
+ * Main function.
+ *
+ * The path of the library to load may be specified as the first argument. By
+ * default, a copy of the library this program is linked against is loaded.
+ *****************************************************************************/
+int main(int const argc, char const *argv[])
+{
+    if(argc >= 3 && std::strcmp(argv[1], "--fresh") == 0)
+    {
+        double results[MEASUREMENTS];
+        measure_fresh(argv[2], results);
+        for(double result : results)
+        {
+            std::printf("%.0lf\n", result);
+        }
+        return EXIT_SUCCESS;
+    }
+
+    // Loading the library this program is linked against would do nothing,
+    // since it has already been loaded.
+    std::string library;
+    char copy[] = "/tmp/libmt19937-XXXXXX";
+    if(argc >= 2)
+    {
+        library = argv[1];
+    }
+    else
+    {
+        std::string original;
+        dl_iterate_phdr(find_library, &original);
+        int fd = mkstemp(copy);
+        if(original.empty() || fd < 0)
+        {
+            std::fprintf(stderr, "Could not copy the library.\n");
+            return EXIT_FAILURE;
+        }
+        close(fd);
+        std::ifstream source(original, std::ios::binary);
+        std::ofstream destination(copy, std::ios::binary);
+        destination << source.rdbuf();
+        library = copy;
+    }
+
+    int const passes = 32;
+    std::vector<double> fresh[MEASUREMENTS], warm[MEASUREMENTS];
+    for(int i = 0; i < passes; ++i)
+    {
+        double results[MEASUREMENTS];
+        spawn(argv[0], library.c_str(), results);
+        for(int j = 0; j < MEASUREMENTS; ++j)
+        {
+            fresh[j].push_back(results[j]);
+        }
+    }
+    for(int i = 0; i < passes; ++i)
+    {
+        double results[MEASUREMENTS];
+        measure_warm(library.c_str(), results);
+        for(int j = 0; j < MEASUREMENTS; ++j)
+        {
+            warm[j].push_back(results[j]);
+        }
+    }
+    if(argc < 2)
+    {
+        unlink(copy);
+    }
+
+    std::printf("%28s %23s %23s\n", "", "fresh (median, min)", "warm (median, min)");
+    for(int j = 0; j < MEASUREMENTS; ++j)
+    {
+        std::printf("%28s %10.0lf %9.0lf ns %10.0lf %9.0lf ns\n", names[j], median(fresh[j]),
+            *std::min_element(fresh[j].begin(), fresh[j].end()), median(warm[j]),
+            *std::min_element(warm[j].begin(), warm[j].end()));
+    }
+}
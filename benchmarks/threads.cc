@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <mt19937.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+static int long const ITERATIONS = 0xFFF0L * 16;
+
+// Per-thread work for one pass of a workload. Each thread runs a given number
+// of iterations and records how long it took.
+typedef void (*Workload)(int thread, int long iterations, std::uint64_t *result);
+
+/******************************************************************************
+ * The internal 32-bit MT19937 object is not thread-safe. Calling the NULL
+ * variants of the functions simultaneously from multiple threads is a data
+ * race (which may make the state index run past the end of the state), so
+ * correct programs sharing it must serialise access.
+ *****************************************************************************/
+static std::mutex global_lock;
+static void global(int, int long iterations, std::uint64_t *result)
+{
+    std::uint64_t accumulator = 0;
+    for(int long i = 0; i < iterations; ++i)
+    {
+        std::lock_guard<std::mutex> guard(global_lock);
+        accumulator ^= mt19937::rand32();
+    }
+    *result = accumulator;
+}
+
+/******************************************************************************
+ * Each thread uses its own object, allocated on its own stack.
+ *****************************************************************************/
+static void private_(int thread, int long iterations, std::uint64_t *result)
+{
+    mt19937_32_t mt(thread);
+    std::uint64_t accumulator = 0;
+    for(int long i = 0; i < iterations; ++i)
+    {
+        accumulator ^= mt.rand32();
+    }
+    *result = accumulator;
+}
+
+/******************************************************************************
+ * Each thread uses its own object, but the objects are adjacent elements of an
+ * array. Since the size of an object is not a multiple of the cache line size,
+ * the last members of one object share a cache line with the first members of
+ * the next.
+ *****************************************************************************/
+static std::vector<mt19937_32_t> adjacent_objects;
+static void adjacent(int thread, int long iterations, std::uint64_t *result)
+{
+    mt19937_32_t& mt = adjacent_objects[thread];
+    std::uint64_t accumulator = 0;
+    for(int long i = 0; i < iterations; ++i)
+    {
+        accumulator ^= mt.rand32();
+    }
+    *result = accumulator;
+}
+
+/******************************************************************************
+ * Run a workload on multiple threads simultaneously.
+ *
+ * @param workload Workload.
+ * @param threads Number of threads.
+ *
+ * @return Minimum (over several passes) of the time taken by the slowest
+ *     thread in nanoseconds.
+ *****************************************************************************/
+static double run(Workload workload, int threads)
+{
+    double delay = HUGE_VAL;
+    for(int pass = 0; pass < 8; ++pass)
+    {
+        std::atomic<int> ready(0);
+        std::atomic<bool> go(false);
+        std::vector<std::uint64_t> results(threads);
+        std::vector<double> delays(threads);
+        std::vector<std::thread> pool;
+        for(int t = 0; t < threads; ++t)
+        {
+            pool.emplace_back([&, t] {
+                ++ready;
+                while(!go)
+                {
+                    std::this_thread::yield();
+                }
+                auto begin = std::chrono::steady_clock::now();
+                workload(t, ITERATIONS, &results[t]);
+                auto end = std::chrono::steady_clock::now();
+                delays[t] = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+            });
+        }
+        while(ready < threads)
+        {
+            std::this_thread::yield();
+        }
+        go = true;
+        for(auto& thread : pool)
+        {
+            thread.join();
+        }
+        delay = std::min(delay, *std::max_element(delays.begin(), delays.end()));
+    }
+    return delay;
+}
+
+static void benchmark(char const *name, Workload workload, int max_threads)
+{
+    double single = 0;
+    for(int threads = 1; threads <= max_threads; ++threads)
+    {
+        double delay = run(workload, threads);
+        double per_call = delay / ITERATIONS;
+        if(threads == 1)
+        {
+            single = per_call;
+        }
+        double throughput = threads * ITERATIONS / delay * 1000;
+        std::printf("%20s %8d %10.2lf M/s %8.2lf ns %8.2lfx\n", name, threads, throughput, per_call, per_call / single);
+    }
+}
+
+/******************************************************************************
+ * Main function.
+ *
+ * The maximum number of threads may be specified as the first argument. By
+ * default, it is the number of hardware threads.
+ *****************************************************************************/
+int main(int const argc, char const *argv[])
+{
+    int max_threads = argc >= 2 ? std::atoi(argv[1]) : std::thread::hardware_concurrency();
+    max_threads = std::max(max_threads, 1);
+    adjacent_objects.resize(max_threads);
+
+    std::printf("%20s %8s %14s %11s %9s\n", "", "threads", "throughput", "per thread", "slowdown");
+    benchmark("global (locked)", global, max_threads);
+    benchmark("private", private_, max_threads);
+    benchmark("adjacent", adjacent, max_threads);
+}
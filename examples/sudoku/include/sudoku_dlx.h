@@ -0,0 +1,6 @@
+#ifndef TFPF_MERSENNE_TWISTER_EXAMPLES_SUDOKU_INCLUDE_SUDOKU_DLX_H_
+#define TFPF_MERSENNE_TWISTER_EXAMPLES_SUDOKU_INCLUDE_SUDOKU_DLX_H_
+
+int solve_sudoku_dlx(int table[][9], int max_solutions);
+
+#endif  // TFPF_MERSENNE_TWISTER_EXAMPLES_SUDOKU_INCLUDE_SUDOKU_DLX_H_
@@ -3,20 +3,117 @@
 
 #include <stdbool.h>
 
+// Rules which the solver may use to eliminate numbers from cells when it
+// cannot fill any cell, tried in this order.
+enum sudoku_rule_t
+{
+    RULE_POINTING,
+    RULE_CLAIMING,
+    RULE_NAKED_PAIRS,
+    RULE_HIDDEN_PAIRS,
+    RULE_X_WING,
+    RULE_NAKED_TRIPLES,
+    RULE_HIDDEN_TRIPLES,
+    RULES,
+};
+extern char const *const rule_names[RULES];
+
+// How the solver finds the cells it can fill. If `sweep` is set, it checks
+// every cell and every number in every row, column and block repeatedly until
+// no cell can be filled. Otherwise, it checks only those which may have been
+// affected by the cells filled since the last check. Bit `rule` of `rules` is
+// set if the rule is to be used.
+struct sudoku_options_t
+{
+    bool sweep;
+    int unsigned rules;
+};
+
+// How much work the solver did: the number of times a cell was checked for
+// having only one number allowed, the number of times a row, column or block
+// was checked for having only one position for a number, and the number of
+// guesses made. For each rule, the number of times it was tried, the number of
+// numbers it eliminated from cells, and the time it took.
+struct sudoku_stats_t
+{
+    int long cell_checks;
+    int long unit_checks;
+    int long guesses;
+    int long rule_calls[RULES];
+    int long rule_eliminations[RULES];
+    int long rule_nanoseconds[RULES];
+};
+
+// Numbers eliminated from the cell at the given position (`9 * row + col`).
+struct elimination_t
+{
+    int position;
+    int unsigned mask;
+};
+
+// A sudoku table, along with the numbers present in each row, column and
+// block. Bit `num - 1` of `rows[i]` is set if and only if `num` is in the row
+// indexed `i`; likewise for `cols` and `blocks`. (Blocks are numbered from 0
+// to 8 in row-major order.) The masks must be updated whenever the table is,
+// so cells should be filled only using `fill_cell` and emptied only using
+// `unfill_cells`. The positions (`9 * row + col`) of the filled cells are
+// stored in `trail` in the order in which they were filled.
+//
+// Bit `num - 1` of `eliminated[row][col]` is set if a rule eliminated `num`
+// from the cell at that position. Numbers should be eliminated only using
+// `eliminate`, which records them in `elimination_trail`, and restored only
+// using `uneliminate`.
+//
+// The time taken by the rules is measured only if `time_rules` is set.
+//
+// Bit `col` of `pending_cells[row]` is set if the cell at that position has to
+// be checked; bit `num - 1` of `pending_rows[i]` is set if the row indexed `i`
+// has to be checked for `num`; likewise for `pending_cols` and
+// `pending_blocks`.
+struct sudoku_t
+{
+    int table[9][9];
+    int unsigned rows[9];
+    int unsigned cols[9];
+    int unsigned blocks[9];
+    int trail[81];
+    int empty;
+    int unsigned eliminated[9][9];
+    struct elimination_t elimination_trail[729];
+    int eliminations;
+    int unsigned pending_cells[9];
+    int unsigned pending_rows[9];
+    int unsigned pending_cols[9];
+    int unsigned pending_blocks[9];
+    struct sudoku_options_t options;
+    struct sudoku_stats_t stats;
+    bool time_rules;
+};
+
 bool read_sudoku(char const *fname, int table[][9]);
-int number_of_empty_cells(int const table[][9]);
 void write_sudoku(int const table[][9]);
-bool allowed_in_row(int const table[][9], int row, int num);
-bool allowed_in_col(int const table[][9], int col, int num);
-bool allowed_in_block(int const table[][9], int row, int col, int num);
-bool allowed_at_position(int const table[][9], int row, int col, int num);
-void select_allowed(int table[][9], int row, int col, bool assign_random);
-void select_possible_in_row(int table[][9], int row, int num);
-void select_possible_in_col(int table[][9], int col, int num);
-void select_possible_in_block(int table[][9], int row, int col, int num);
-void select_possible(int table[][9], int num);
-void single_pass(int table[][9], bool assign_random);
-void solve_sudoku(int table[][9]);
+void init_sudoku(struct sudoku_t *sudoku, int const table[][9], struct sudoku_options_t const *options);
+void fill_cell(struct sudoku_t *sudoku, int row, int col, int num);
+void unfill_cells(struct sudoku_t *sudoku, int empty);
+bool eliminate(struct sudoku_t *sudoku, int row, int col, int unsigned mask);
+void uneliminate(struct sudoku_t *sudoku, int eliminations);
+int unsigned allowed_mask(struct sudoku_t const *sudoku, int row, int col);
+bool allowed_in_row(struct sudoku_t const *sudoku, int row, int num);
+bool allowed_in_col(struct sudoku_t const *sudoku, int col, int num);
+bool allowed_in_block(struct sudoku_t const *sudoku, int row, int col, int num);
+bool allowed_at_position(struct sudoku_t const *sudoku, int row, int col, int num);
+bool select_allowed(struct sudoku_t *sudoku, int row, int col);
+bool select_possible_in_row(struct sudoku_t *sudoku, int row, int num);
+bool select_possible_in_col(struct sudoku_t *sudoku, int col, int num);
+bool select_possible_in_block(struct sudoku_t *sudoku, int row, int col, int num);
+bool select_possible(struct sudoku_t *sudoku, int num);
+bool single_pass(struct sudoku_t *sudoku);
+bool propagate(struct sudoku_t *sudoku);
+bool apply_rules(struct sudoku_t *sudoku);
+bool search_sudoku(struct sudoku_t *sudoku, bool randomise);
+bool solve_sudoku(
+    int table[][9], bool randomise, struct sudoku_options_t const *options, struct sudoku_stats_t *stats
+);
 void generate_sudoku(int table[][9], double difficulty);
 bool validate_sudoku(int const table[][9], bool initial);
 
@@ -5,8 +5,10 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
+#include "sudoku_dlx.h"
 #include "sudoku_utils.h"
 
 #define REPORT_RUNNING_TIME(function_call, delay_micro) \
@@ -19,6 +21,194 @@ int long delay_micro; \
     delay_micro = (int long)(end.tv_sec - begin.tv_sec) * 1000000 + (end.tv_nsec - begin.tv_nsec) / 1000; \
 }
 
+/******************************************************************************
+ * Solve the sudoku puzzle using depth-first search, checking only the cells,
+ * rows, columns and blocks affected by the cells filled.
+ *
+ * @param table Sudoku table.
+ * @param rules Mask of rules to use.
+ * @param stats Variable to store the amount of work done in, or `NULL`.
+ *
+ * @return `true` if the puzzle was solved, else `false`.
+ *****************************************************************************/
+static bool solve_dfs(int table[][9], int unsigned rules, struct sudoku_stats_t *stats)
+{
+    return solve_sudoku(table, false, &(struct sudoku_options_t){.sweep = false, .rules = rules}, stats);
+}
+
+/******************************************************************************
+ * Solve the sudoku puzzle using depth-first search, checking all cells, rows,
+ * columns and blocks repeatedly.
+ *
+ * @param table Sudoku table.
+ * @param rules Mask of rules to use.
+ * @param stats Variable to store the amount of work done in, or `NULL`.
+ *
+ * @return `true` if the puzzle was solved, else `false`.
+ *****************************************************************************/
+static bool solve_dfs_sweep(int table[][9], int unsigned rules, struct sudoku_stats_t *stats)
+{
+    return solve_sudoku(table, false, &(struct sudoku_options_t){.sweep = true, .rules = rules}, stats);
+}
+
+/******************************************************************************
+ * Solve the sudoku puzzle using Dancing Links.
+ *
+ * @param table Sudoku table.
+ * @param rules Unused.
+ * @param stats Unused.
+ *
+ * @return `true` if the puzzle was solved, else `false`.
+ *****************************************************************************/
+static bool solve_dlx(int table[][9], int unsigned rules, struct sudoku_stats_t *stats)
+{
+    (void)rules;
+    (void)stats;
+    return solve_sudoku_dlx(table, 1) == 1;
+}
+
+// Solvers which can be selected. Only depth-first search uses the rules and
+// reports the amount of work done.
+static struct engine_t
+{
+    char const *name;
+    bool (*solve)(int table[][9], int unsigned rules, struct sudoku_stats_t *stats);
+    bool has_stats;
+}
+const engines[] = {
+    {"dfs", solve_dfs, true},
+    {"dfs-sweep", solve_dfs_sweep, true},
+    {"dlx", solve_dlx, false},
+};
+#define ENGINES (sizeof engines / sizeof *engines)
+#define BENCHMARK_PASSES 32
+
+/******************************************************************************
+ * Parse a comma-separated list of rule names.
+ *
+ * @param names List of rule names, `all` or `none`.
+ * @param rules Variable to store the mask of rules in.
+ *
+ * @return `true` if all names were recognised, else `false`.
+ *****************************************************************************/
+static bool parse_rules(char const *names, int unsigned *rules)
+{
+    *rules = 0;
+    if(strcmp(names, "none") == 0)
+    {
+        return true;
+    }
+    if(strcmp(names, "all") == 0)
+    {
+        *rules = (1U << RULES) - 1;
+        return true;
+    }
+    while(true)
+    {
+        size_t length = strcspn(names, ",");
+        int rule = 0;
+        while(rule < RULES && (strlen(rule_names[rule]) != length || strncmp(names, rule_names[rule], length) != 0))
+        {
+            ++rule;
+        }
+        if(rule == RULES)
+        {
+            return false;
+        }
+        *rules |= 1U << rule;
+        if(names[length] == '\0')
+        {
+            return true;
+        }
+        names += length + 1;
+    }
+}
+
+/******************************************************************************
+ * Write the amount of work done to solve a sudoku puzzle. Write the work done
+ * by each rule tried on separate lines.
+ *
+ * @param stats Amount of work done.
+ *****************************************************************************/
+static void write_stats(struct sudoku_stats_t const *stats)
+{
+    printf(
+        "%8ld cell checks %8ld unit checks %6ld guesses\n", stats->cell_checks, stats->unit_checks, stats->guesses
+    );
+    for(int rule = 0; rule < RULES; ++rule)
+    {
+        if(stats->rule_calls[rule] > 0)
+        {
+            printf(
+                "    %-16s %8ld calls %8ld eliminations %10ld ns\n",
+                rule_names[rule],
+                stats->rule_calls[rule],
+                stats->rule_eliminations[rule],
+                stats->rule_nanoseconds[rule]
+            );
+        }
+    }
+}
+
+/******************************************************************************
+ * Solve each sudoku puzzle several times using each engine, and write the
+ * shortest time taken (and, if requested and available, the amount of work
+ * done).
+ *
+ * @param fnames File names.
+ * @param count Number of file names.
+ * @param rules Mask of rules to use.
+ * @param show_stats Whether to write the amount of work done. If not, it is
+ *     not measured, so that measuring it does not affect the time taken.
+ *
+ * @return `EXIT_SUCCESS` if all puzzles were solved, else `EXIT_FAILURE`.
+ *****************************************************************************/
+static int benchmark(char const *fnames[], int count, int unsigned rules, bool show_stats)
+{
+    for(int i = 0; i < count; ++i)
+    {
+        int puzzle[9][9];
+        if(!read_sudoku(fnames[i], puzzle) || !validate_sudoku(puzzle, true))
+        {
+            fprintf(stderr, "Could not read the puzzle in %s.\n", fnames[i]);
+            return EXIT_FAILURE;
+        }
+        for(size_t e = 0; e < ENGINES; ++e)
+        {
+            int long shortest = -1;
+            struct sudoku_stats_t stats, shortest_stats;
+            for(int pass = 0; pass < BENCHMARK_PASSES; ++pass)
+            {
+                int table[9][9];
+                memcpy(table, puzzle, sizeof table);
+                bool solved;
+                REPORT_RUNNING_TIME(solved = engines[e].solve(table, rules, show_stats ? &stats : NULL), delay_micro)
+                if(!solved || !validate_sudoku(table, false))
+                {
+                    fprintf(stderr, "Could not find the solution of %s using %s.\n", fnames[i], engines[e].name);
+                    return EXIT_FAILURE;
+                }
+                if(shortest < 0 || delay_micro < shortest)
+                {
+                    shortest = delay_micro;
+                    shortest_stats = stats;
+                }
+            }
+            printf("%-48s %-9s %10ld μs", fnames[i], engines[e].name, shortest);
+            if(show_stats && engines[e].has_stats)
+            {
+                printf(" ");
+                write_stats(&shortest_stats);
+            }
+            else
+            {
+                printf("\n");
+            }
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
 /******************************************************************************
  * Main function.
  *****************************************************************************/
@@ -26,19 +216,65 @@ int main(int const argc, char const *argv[])
 {
     mt19937_init32(NULL);
 
+    // Options precede the other arguments.
+    struct engine_t const *engine = &engines[0];
+    // On most puzzles, the rules take longer than the guesses they save, so
+    // none is used unless requested.
+    int unsigned rules = 0;
+    bool run_benchmark = false, show_stats = false;
+    int argi = 1;
+    for(; argi < argc && strncmp(argv[argi], "--", 2) == 0; ++argi)
+    {
+        if(strcmp(argv[argi], "--benchmark") == 0)
+        {
+            run_benchmark = true;
+            continue;
+        }
+        if(strcmp(argv[argi], "--stats") == 0)
+        {
+            show_stats = true;
+            continue;
+        }
+        if(strncmp(argv[argi], "--rules=", 8) == 0 && parse_rules(argv[argi] + 8, &rules))
+        {
+            continue;
+        }
+        if(strncmp(argv[argi], "--engine=", 9) == 0)
+        {
+            engine = NULL;
+            for(size_t e = 0; e < ENGINES; ++e)
+            {
+                if(strcmp(argv[argi] + 9, engines[e].name) == 0)
+                {
+                    engine = &engines[e];
+                }
+            }
+            if(engine != NULL)
+            {
+                continue;
+            }
+        }
+        fprintf(stderr, "Unknown option: %s\n", argv[argi]);
+        return EXIT_FAILURE;
+    }
+    if(run_benchmark)
+    {
+        return benchmark(argv + argi, argc - argi, rules, show_stats);
+    }
+
     // Generate a puzzle if the first argument is a number.
     int table[9][9] = {{0}};
     char const *fname = NULL;
-    if(argc >= 2)
+    if(argi < argc)
     {
         char *endptr;
-        double difficulty = strtod(argv[1], &endptr);
+        double difficulty = strtod(argv[argi], &endptr);
         if(*endptr == '\0')
         {
             generate_sudoku(table, difficulty);
             return EXIT_SUCCESS;
         }
-        fname = argv[1];
+        fname = argv[argi];
     }
 
     // Solve the given puzzle if the first argument is a file name (or isn't
@@ -54,7 +290,8 @@ int main(int const argc, char const *argv[])
         return EXIT_FAILURE;
     }
 
-    REPORT_RUNNING_TIME(solve_sudoku(table), delay_micro)
+    struct sudoku_stats_t stats;
+    REPORT_RUNNING_TIME(engine->solve(table, rules, show_stats ? &stats : NULL), delay_micro)
     write_sudoku(table);
     if(!validate_sudoku(table, false))
     {
@@ -62,5 +299,9 @@ int main(int const argc, char const *argv[])
         return EXIT_FAILURE;
     }
     printf("Solved in %ld μs (real time).\n", delay_micro);
+    if(show_stats && engine->has_stats)
+    {
+        write_stats(&stats);
+    }
     return EXIT_SUCCESS;
 }
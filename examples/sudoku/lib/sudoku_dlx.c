@@ -0,0 +1,248 @@
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "sudoku_dlx.h"
+
+/******************************************************************************
+ * Sudoku as an exact cover problem, solved using Knuth's Algorithm X with
+ * Dancing Links.
+ *
+ * There is a column for each of the 324 constraints: each cell must be filled
+ * (column `9 * row + col`), and each number must appear in each row (column
+ * `81 + 9 * row + num - 1`), in each column (column `162 + 9 * col + num - 1`)
+ * and in each block (column `243 + 9 * block + num - 1`). There is a row for
+ * each of the 729 ways of placing a number in a cell (row
+ * `81 * row + 9 * col + num - 1`), which has a node in each of the four
+ * columns it satisfies.
+ *
+ * The nodes are allocated statically and linked together once. The rows of
+ * the numbers given in a puzzle are selected before searching and deselected
+ * afterwards, which leaves the links as they were. Hence, these functions are
+ * not thread-safe.
+ *****************************************************************************/
+#define DLX_COLUMNS 324
+#define DLX_ROWS 729
+
+// Node 0 is the root, nodes 1 to `DLX_COLUMNS` are the column headers, and
+// the four nodes of each row follow. Links are indices into `nodes`.
+struct dlx_node_t
+{
+    int left, right, up, down;
+    int column;
+};
+
+static struct dlx_node_t nodes[1 + DLX_COLUMNS + 4 * DLX_ROWS];
+static int sizes[1 + DLX_COLUMNS];
+static bool linked = false;
+
+/******************************************************************************
+ * Find the index of the first node of a row.
+ *
+ * @param row Number from 0 to 728.
+ *
+ * @return Node index.
+ *****************************************************************************/
+static int first_node(int row)
+{
+    return 1 + DLX_COLUMNS + 4 * row;
+}
+
+/******************************************************************************
+ * Link all nodes together, unless that has already been done.
+ *****************************************************************************/
+static void link_nodes(void)
+{
+    if(linked)
+    {
+        return;
+    }
+    linked = true;
+
+    for(int c = 0; c <= DLX_COLUMNS; ++c)
+    {
+        nodes[c].left = c == 0 ? DLX_COLUMNS : c - 1;
+        nodes[c].right = c == DLX_COLUMNS ? 0 : c + 1;
+        nodes[c].up = nodes[c].down = nodes[c].column = c;
+        sizes[c] = 0;
+    }
+    for(int row = 0; row < 9; ++row)
+    {
+        for(int col = 0; col < 9; ++col)
+        {
+            for(int num = 1; num <= 9; ++num)
+            {
+                int block = row / 3 * 3 + col / 3;
+                int columns[] = {
+                    1 + 9 * row + col,
+                    1 + 81 + 9 * row + num - 1,
+                    1 + 162 + 9 * col + num - 1,
+                    1 + 243 + 9 * block + num - 1,
+                };
+                int first = first_node(81 * row + 9 * col + num - 1);
+                for(int k = 0; k < 4; ++k)
+                {
+                    int n = first + k;
+                    int c = columns[k];
+                    nodes[n].left = first + (k + 3) % 4;
+                    nodes[n].right = first + (k + 1) % 4;
+                    nodes[n].column = c;
+                    nodes[n].up = nodes[c].up;
+                    nodes[n].down = c;
+                    nodes[nodes[c].up].down = n;
+                    nodes[c].up = n;
+                    ++sizes[c];
+                }
+            }
+        }
+    }
+}
+
+/******************************************************************************
+ * Remove a column from the header list, and remove the rows which have a node
+ * in it from the other columns.
+ *
+ * @param c Column header index.
+ *****************************************************************************/
+static void cover(int c)
+{
+    nodes[nodes[c].right].left = nodes[c].left;
+    nodes[nodes[c].left].right = nodes[c].right;
+    for(int i = nodes[c].down; i != c; i = nodes[i].down)
+    {
+        for(int j = nodes[i].right; j != i; j = nodes[j].right)
+        {
+            nodes[nodes[j].down].up = nodes[j].up;
+            nodes[nodes[j].up].down = nodes[j].down;
+            --sizes[nodes[j].column];
+        }
+    }
+}
+
+/******************************************************************************
+ * Undo `cover`. Calls to these two functions must be nested.
+ *
+ * @param c Column header index.
+ *****************************************************************************/
+static void uncover(int c)
+{
+    for(int i = nodes[c].up; i != c; i = nodes[i].up)
+    {
+        for(int j = nodes[i].left; j != i; j = nodes[j].left)
+        {
+            ++sizes[nodes[j].column];
+            nodes[nodes[j].down].up = j;
+            nodes[nodes[j].up].down = j;
+        }
+    }
+    nodes[nodes[c].right].left = c;
+    nodes[nodes[c].left].right = c;
+}
+
+/******************************************************************************
+ * Search for solutions, choosing the column with the fewest rows at each step.
+ *
+ * @param table Sudoku table into which to write the solution found, or
+ *     `NULL`.
+ * @param selected Nodes of the rows selected so far.
+ * @param depth Number of rows selected so far.
+ * @param max_solutions Number of solutions to stop at.
+ *
+ * @return Number of solutions found.
+ *****************************************************************************/
+static int search(int table[][9], int selected[], int depth, int max_solutions)
+{
+    if(nodes[0].right == 0)
+    {
+        for(int k = 0; table != NULL && k < depth; ++k)
+        {
+            int row = (selected[k] - first_node(0)) / 4;
+            table[row / 81][row / 9 % 9] = row % 9 + 1;
+        }
+        return 1;
+    }
+
+    int c = nodes[0].right;
+    for(int j = nodes[c].right; j != 0 && sizes[c] > 1; j = nodes[j].right)
+    {
+        if(sizes[j] < sizes[c])
+        {
+            c = j;
+        }
+    }
+    if(sizes[c] == 0)
+    {
+        return 0;
+    }
+
+    int solutions = 0;
+    cover(c);
+    for(int i = nodes[c].down; i != c && solutions < max_solutions; i = nodes[i].down)
+    {
+        selected[depth] = i;
+        for(int j = nodes[i].right; j != i; j = nodes[j].right)
+        {
+            cover(nodes[j].column);
+        }
+        solutions += search(solutions == 0 ? table : NULL, selected, depth + 1, max_solutions - solutions);
+        for(int j = nodes[i].left; j != i; j = nodes[j].left)
+        {
+            uncover(nodes[j].column);
+        }
+    }
+    uncover(c);
+    return solutions;
+}
+
+/******************************************************************************
+ * Solve the sudoku puzzle using Dancing Links, counting its solutions.
+ *
+ * @param table Sudoku table. Must not contain any number twice in any row,
+ *     column or block. If the puzzle is solvable, the first solution found is
+ *     written into it; otherwise, it is not modified.
+ * @param max_solutions Number of solutions to stop counting at. Must be
+ *     positive.
+ *
+ * @return Number of solutions (at most `max_solutions`).
+ *****************************************************************************/
+int solve_sudoku_dlx(int table[][9], int max_solutions)
+{
+    link_nodes();
+
+    // Select the rows of the given numbers.
+    int selected[81];
+    int givens = 0;
+    for(int row = 0; row < 9; ++row)
+    {
+        for(int col = 0; col < 9; ++col)
+        {
+            if(table[row][col] != 0)
+            {
+                selected[givens++] = first_node(81 * row + 9 * col + table[row][col] - 1);
+            }
+        }
+    }
+    for(int k = 0; k < givens; ++k)
+    {
+        int j = selected[k];
+        do
+        {
+            cover(nodes[j].column);
+            j = nodes[j].right;
+        }
+        while(j != selected[k]);
+    }
+
+    int solutions = search(table, selected, givens, max_solutions);
+
+    for(int k = givens - 1; k >= 0; --k)
+    {
+        int j = selected[k];
+        do
+        {
+            j = nodes[j].left;
+            uncover(nodes[j].column);
+        }
+        while(j != selected[k]);
+    }
+    return solutions;
+}
@@ -1,6 +1,5 @@
 #define _POSIX_C_SOURCE 199309L
 
-#include <limits.h>
 #include <math.h>
 #include <mt19937.h>
 #include <stdbool.h>
@@ -11,8 +10,19 @@
 #include <time.h>
 #include <unistd.h>
 
+#include "sudoku_dlx.h"
 #include "sudoku_utils.h"
 
+char const *const rule_names[RULES] = {
+    [RULE_POINTING] = "pointing",
+    [RULE_CLAIMING] = "claiming",
+    [RULE_NAKED_PAIRS] = "naked-pairs",
+    [RULE_HIDDEN_PAIRS] = "hidden-pairs",
+    [RULE_X_WING] = "x-wing",
+    [RULE_NAKED_TRIPLES] = "naked-triples",
+    [RULE_HIDDEN_TRIPLES] = "hidden-triples",
+};
+
 /******************************************************************************
  * Read a sudoku puzzle into a two-dimensional array. Zeros are used to
  * represent blank cells. The format of the input file is the same as that
@@ -50,29 +60,6 @@ bool read_sudoku(char const *fname, int table[][9])
     return true;
 }
 
-/******************************************************************************
- * Count the empty cells (i.e. the positions filled with zeros) in the sudoku.
- *
- * @param table Sudoku table.
- *
- * @return Number of empty cells.
- *****************************************************************************/
-int number_of_empty_cells(int const table[][9])
-{
-    int zeros = 0;
-    for(int i = 0; i < 9; ++i)
-    {
-        for(int j = 0; j < 9; ++j)
-        {
-            if(table[i][j] == 0)
-            {
-                ++zeros;
-            }
-        }
-    }
-    return zeros;
-}
-
 /******************************************************************************
  * Display the sudoku table. If standard output is a terminal, draw adjacent
  * blocks with different background colours using ANSI escape sequences.
@@ -117,87 +104,228 @@ void write_sudoku(int const table[][9])
 }
 
 /******************************************************************************
- * Check whether the number given may be placed in the given row.
+ * Prepare to solve a sudoku puzzle: copy the table, and find which numbers are
+ * present in each row, column and block. Mark every cell, row, column and
+ * block as having to be checked.
  *
- * @param table Sudoku table.
- * @param row Number from 0 to 8.
- * @param num Number from 1 to 9.
- *
- * @return `true` if `num` isn't in the row indexed `row`, else `false`.
+ * @param sudoku Sudoku object to initialise.
+ * @param table Sudoku table. Must not contain any number twice in any row,
+ *     column or block.
+ * @param options Solver options. If `NULL`, the defaults (all members zero)
+ *     are used.
  *****************************************************************************/
-bool allowed_in_row(int const table[][9], int row, int num)
+void init_sudoku(struct sudoku_t *sudoku, int const table[][9], struct sudoku_options_t const *options)
 {
-    for(int j = 0; j < 9; ++j)
+    for(int i = 0; i < 9; ++i)
+    {
+        sudoku->rows[i] = sudoku->cols[i] = sudoku->blocks[i] = 0;
+    }
+    sudoku->empty = 81;
+    sudoku->eliminations = 0;
+    sudoku->options = options == NULL ? (struct sudoku_options_t){0} : *options;
+    sudoku->stats = (struct sudoku_stats_t){0};
+    sudoku->time_rules = false;
+    for(int i = 0; i < 9; ++i)
     {
-        if(table[row][j] == num)
+        for(int j = 0; j < 9; ++j)
         {
-            return false;
+            sudoku->table[i][j] = 0;
+            sudoku->eliminated[i][j] = 0;
+            if(table[i][j] != 0)
+            {
+                fill_cell(sudoku, i, j, table[i][j]);
+            }
         }
     }
-    return true;
+    for(int i = 0; i < 9; ++i)
+    {
+        sudoku->pending_cells[i] = 0x1FFU;
+        sudoku->pending_rows[i] = sudoku->pending_cols[i] = sudoku->pending_blocks[i] = 0x1FFU;
+    }
 }
 
 /******************************************************************************
- * Check whether the number given may be placed in the given column.
+ * Place a number at the given position, and record that it is present in the
+ * row, column and block containing that position. Mark the cells, rows,
+ * columns and blocks which may be affected as having to be checked. At the
+ * time of calling this function, it must be true that
+ * `sudoku->table[row][col] == 0`.
  *
- * @param table Sudoku table.
+ * @param sudoku Sudoku object.
+ * @param row Number from 0 to 8.
  * @param col Number from 0 to 8.
  * @param num Number from 1 to 9.
- *
- * @return `true` if `num` isn't in the column indexed `col`, else `false`.
  *****************************************************************************/
-bool allowed_in_col(int const table[][9], int col, int num)
+void fill_cell(struct sudoku_t *sudoku, int row, int col, int num)
 {
+    int unsigned bit = 1U << (num - 1);
+    sudoku->table[row][col] = num;
+    sudoku->rows[row] |= bit;
+    sudoku->cols[col] |= bit;
+    sudoku->blocks[row / 3 * 3 + col / 3] |= bit;
+    sudoku->trail[81 - sudoku->empty--] = 9 * row + col;
+
+    // The number is no longer allowed in the cells in the same row, column or
+    // block, so some of those may have only one number allowed now.
+    int block_row = row / 3 * 3, block_col = col / 3 * 3;
     for(int i = 0; i < 9; ++i)
     {
-        if(table[i][col] == num)
-        {
-            return false;
-        }
+        sudoku->pending_cells[i] |= 1U << col;
     }
-    return true;
+    sudoku->pending_cells[row] = 0x1FFU;
+    for(int i = block_row; i < block_row + 3; ++i)
+    {
+        sudoku->pending_cells[i] |= 7U << block_col;
+    }
+
+    // The rows, columns and blocks containing those cells may have only one
+    // position left for the number. The ones containing this cell may have
+    // only one position left for any number.
+    for(int i = 0; i < 9; ++i)
+    {
+        sudoku->pending_rows[i] |= bit;
+        sudoku->pending_cols[i] |= bit;
+        sudoku->pending_blocks[row / 3 * 3 + i / 3] |= bit;
+        sudoku->pending_blocks[i / 3 * 3 + col / 3] |= bit;
+    }
+    sudoku->pending_rows[row] = sudoku->pending_cols[col] = sudoku->pending_blocks[row / 3 * 3 + col / 3] = 0x1FFU;
 }
 
 /******************************************************************************
- * Check whether the number given may be placed in the indicated block. Scan
- * only those positions whose row and column indices differ from `row` and
- * `col` respectively, since the other positions will be checked by
- * `allowed_in_row` and `allowed_in_col`.
+ * Empty the cells most recently filled, undoing calls to `fill_cell` in the
+ * opposite order, until the given number of cells are empty.
  *
- * @param table Sudoku table.
+ * @param sudoku Sudoku object.
+ * @param empty Number of empty cells to stop at. Must not be less than
+ *     `sudoku->empty`.
+ *****************************************************************************/
+void unfill_cells(struct sudoku_t *sudoku, int empty)
+{
+    while(sudoku->empty < empty)
+    {
+        int position = sudoku->trail[81 - ++sudoku->empty];
+        int row = position / 9, col = position % 9;
+        int unsigned bit = 1U << (sudoku->table[row][col] - 1);
+        sudoku->table[row][col] = 0;
+        sudoku->rows[row] &= ~bit;
+        sudoku->cols[col] &= ~bit;
+        sudoku->blocks[row / 3 * 3 + col / 3] &= ~bit;
+    }
+}
+
+/******************************************************************************
+ * Eliminate numbers from the given position, and mark the cell, and the row,
+ * column and block containing it, as having to be checked. At the time of
+ * calling this function, it must be true that `sudoku->table[row][col] == 0`.
+ *
+ * @param sudoku Sudoku object.
  * @param row Number from 0 to 8.
  * @param col Number from 0 to 8.
- * @param num Number from 1 to 9.
+ * @param mask Mask in which bit `num - 1` is set if `num` is to be eliminated.
  *
- * @return `true` if `num` isn't in the block which contains the cell
- *     with row index `row` and column index `col` at a position with row
- *     index different from `row` and column index different from `col`, else
+ * @return `true` if any of the numbers was allowed at the position, else
  *     `false`.
  *****************************************************************************/
-bool allowed_in_block(int const table[][9], int row, int col, int num)
+bool eliminate(struct sudoku_t *sudoku, int row, int col, int unsigned mask)
 {
-    // Find out where the block indicated by `row` and `col` begins.
-    int block_row_start = row - row % 3;
-    int block_col_start = col - col % 3;
-
-    for(int i = block_row_start; i < block_row_start + 3; ++i)
+    mask &= allowed_mask(sudoku, row, col);
+    if(mask == 0)
     {
-        for(int j = block_col_start; j < block_col_start + 3; ++j)
-        {
-            if(i != row && j != col && table[i][j] == num)
-            {
-                return false;
-            }
-        }
+        return false;
     }
+    sudoku->eliminated[row][col] |= mask;
+    sudoku->elimination_trail[sudoku->eliminations++] = (struct elimination_t){9 * row + col, mask};
+    sudoku->pending_cells[row] |= 1U << col;
+    sudoku->pending_rows[row] |= mask;
+    sudoku->pending_cols[col] |= mask;
+    sudoku->pending_blocks[row / 3 * 3 + col / 3] |= mask;
     return true;
 }
 
+/******************************************************************************
+ * Restore the numbers most recently eliminated, undoing calls to `eliminate`
+ * in the opposite order, until the given number of calls remain.
+ *
+ * @param sudoku Sudoku object.
+ * @param eliminations Number of calls to stop at. Must not be more than
+ *     `sudoku->eliminations`.
+ *****************************************************************************/
+void uneliminate(struct sudoku_t *sudoku, int eliminations)
+{
+    while(sudoku->eliminations > eliminations)
+    {
+        struct elimination_t const *elimination = &sudoku->elimination_trail[--sudoku->eliminations];
+        sudoku->eliminated[elimination->position / 9][elimination->position % 9] &= ~elimination->mask;
+    }
+}
+
+/******************************************************************************
+ * Find the numbers which may be placed at the given position.
+ *
+ * @param sudoku Sudoku object.
+ * @param row Number from 0 to 8.
+ * @param col Number from 0 to 8.
+ *
+ * @return Mask in which bit `num - 1` is set if and only if `num` isn't in the
+ *     row, column or block containing the position, and hasn't been
+ *     eliminated from it.
+ *****************************************************************************/
+int unsigned allowed_mask(struct sudoku_t const *sudoku, int row, int col)
+{
+    int unsigned present = sudoku->rows[row] | sudoku->cols[col] | sudoku->blocks[row / 3 * 3 + col / 3];
+    return ~(present | sudoku->eliminated[row][col]) & 0x1FFU;
+}
+
+/******************************************************************************
+ * Check whether the number given may be placed in the given row.
+ *
+ * @param sudoku Sudoku object.
+ * @param row Number from 0 to 8.
+ * @param num Number from 1 to 9.
+ *
+ * @return `true` if `num` isn't in the row indexed `row`, else `false`.
+ *****************************************************************************/
+bool allowed_in_row(struct sudoku_t const *sudoku, int row, int num)
+{
+    return (sudoku->rows[row] >> (num - 1) & 1) == 0;
+}
+
+/******************************************************************************
+ * Check whether the number given may be placed in the given column.
+ *
+ * @param sudoku Sudoku object.
+ * @param col Number from 0 to 8.
+ * @param num Number from 1 to 9.
+ *
+ * @return `true` if `num` isn't in the column indexed `col`, else `false`.
+ *****************************************************************************/
+bool allowed_in_col(struct sudoku_t const *sudoku, int col, int num)
+{
+    return (sudoku->cols[col] >> (num - 1) & 1) == 0;
+}
+
+/******************************************************************************
+ * Check whether the number given may be placed in the indicated block.
+ *
+ * @param sudoku Sudoku object.
+ * @param row Number from 0 to 8.
+ * @param col Number from 0 to 8.
+ * @param num Number from 1 to 9.
+ *
+ * @return `true` if `num` isn't in the block which contains the cell with row
+ *     index `row` and column index `col`, else `false`.
+ *****************************************************************************/
+bool allowed_in_block(struct sudoku_t const *sudoku, int row, int col, int num)
+{
+    return (sudoku->blocks[row / 3 * 3 + col / 3] >> (num - 1) & 1) == 0;
+}
+
 /******************************************************************************
  * Check whether the number given may be placed at the given position. At the
- * time of calling this function, it must be true that `table[row][col] == 0`.
+ * time of calling this function, it must be true that
+ * `sudoku->table[row][col] == 0`.
  *
- * @param table Sudoku table.
+ * @param sudoku Sudoku object.
  * @param row Number from 0 to 8.
  * @param col Number from 0 to 8.
  * @param num Number from 1 to 9.
@@ -205,74 +333,62 @@ bool allowed_in_block(int const table[][9], int row, int col, int num)
  * @return `true` if `num` may appear at row index `row` and column index
  *     `col`, else `false`.
  *****************************************************************************/
-bool allowed_at_position(int const table[][9], int row, int col, int num)
+bool allowed_at_position(struct sudoku_t const *sudoku, int row, int col, int num)
 {
-    return allowed_in_row(table, row, num)
-           && allowed_in_col(table, col, num)
-           && allowed_in_block(table, row, col, num);
+    return (allowed_mask(sudoku, row, col) >> (num - 1) & 1) != 0;
 }
 
 /******************************************************************************
  * Check how many numbers are allowed at the given position. If only a single
- * number is allowed, assign it at that position. Otherwise, do nothing.
- * (Alternatively, assign a permitted number at that position randomly, if told
- * to do so.) At the time of calling this function, it must be true that
- * `table[row][col] == 0`.
+ * number is allowed, assign it at that position. Otherwise, do nothing. At the
+ * time of calling this function, it must be true that
+ * `sudoku->table[row][col] == 0`.
  *
- * @param table Sudoku table.
+ * @param sudoku Sudoku object.
  * @param row Number from 0 to 8.
  * @param col Number from 0 to 8.
- * @param assign_random Whether to assign `table[row][col]` randomly or not.
+ *
+ * @return `false` if no number is allowed at the position, else `true`.
  *****************************************************************************/
-void select_allowed(int table[][9], int row, int col, bool assign_random)
+bool select_allowed(struct sudoku_t *sudoku, int row, int col)
 {
-    int allowed[9];
-    int count_allowed = 0;
-    for(int num = 1; num <= 9; ++num)
+    ++sudoku->stats.cell_checks;
+    int unsigned allowed = allowed_mask(sudoku, row, col);
+    if(allowed != 0 && (allowed & (allowed - 1)) == 0)
     {
-        if(allowed_at_position(table, row, col, num))
-        {
-            if(count_allowed > 0 && !assign_random)
-            {
-                return;
-            }
-            allowed[count_allowed++] = num;
-        }
-    }
-    if(count_allowed == 1)
-    {
-        table[row][col] = allowed[0];
-    }
-    else if(count_allowed > 1 && assign_random)
-    {
-        table[row][col] = allowed[mt19937_uint32(count_allowed, NULL)];
+        fill_cell(sudoku, row, col, __builtin_ctz(allowed) + 1);
     }
+    return allowed != 0;
 }
 
 /******************************************************************************
  * Check how many positions the given number can be placed at in the given row.
  * If there is only one position, assign it there. Otherwise, do nothing.
  *
- * @param table Sudoku table.
+ * @param sudoku Sudoku object.
  * @param row Number from 0 to 8.
  * @param num Number from 1 to 9.
+ *
+ * @return `false` if the number isn't in the row and can't be placed anywhere
+ *     in it, else `true`.
  *****************************************************************************/
-void select_possible_in_row(int table[][9], int row, int num)
+bool select_possible_in_row(struct sudoku_t *sudoku, int row, int num)
 {
-    if(!allowed_in_row(table, row, num))
+    ++sudoku->stats.unit_checks;
+    if(!allowed_in_row(sudoku, row, num))
     {
-        return;
+        return true;
     }
 
     int possible_col;
     int count_possible = 0;
     for(int j = 0; j < 9; ++j)
     {
-        if(table[row][j] == 0 && allowed_in_col(table, j, num) && allowed_in_block(table, row, j, num))
+        if(sudoku->table[row][j] == 0 && allowed_at_position(sudoku, row, j, num))
         {
             if(count_possible > 0)
             {
-                return;
+                return true;
             }
             possible_col = j;
             ++count_possible;
@@ -280,8 +396,9 @@ void select_possible_in_row(int table[][9], int row, int num)
     }
     if(count_possible == 1)
     {
-        table[row][possible_col] = num;
+        fill_cell(sudoku, row, possible_col, num);
     }
+    return count_possible == 1;
 }
 
 /******************************************************************************
@@ -289,26 +406,30 @@ void select_possible_in_row(int table[][9], int row, int num)
  * column. If there is only one position, assign it there. Otherwise, do
  * nothing.
  *
- * @param table Sudoku table.
+ * @param sudoku Sudoku object.
  * @param col Number from 0 to 8.
  * @param num Number from 1 to 9.
+ *
+ * @return `false` if the number isn't in the column and can't be placed
+ *     anywhere in it, else `true`.
  *****************************************************************************/
-void select_possible_in_col(int table[][9], int col, int num)
+bool select_possible_in_col(struct sudoku_t *sudoku, int col, int num)
 {
-    if(!allowed_in_col(table, col, num))
+    ++sudoku->stats.unit_checks;
+    if(!allowed_in_col(sudoku, col, num))
     {
-        return;
+        return true;
     }
 
     int possible_row;
     int count_possible = 0;
     for(int i = 0; i < 9; ++i)
     {
-        if(table[i][col] == 0 && allowed_in_row(table, i, num) && allowed_in_block(table, i, col, num))
+        if(sudoku->table[i][col] == 0 && allowed_at_position(sudoku, i, col, num))
         {
             if(count_possible > 0)
             {
-                return;
+                return true;
             }
             possible_row = i;
             ++count_possible;
@@ -316,8 +437,9 @@ void select_possible_in_col(int table[][9], int col, int num)
     }
     if(count_possible == 1)
     {
-        table[possible_row][col] = num;
+        fill_cell(sudoku, possible_row, col, num);
     }
+    return count_possible == 1;
 }
 
 /******************************************************************************
@@ -325,16 +447,20 @@ void select_possible_in_col(int table[][9], int col, int num)
  * block. If there is only one position, assign it at there. Otherwise, do
  * nothing.
  *
- * @param table Sudoku table.
+ * @param sudoku Sudoku object.
  * @param row Row index of the first cell of a block. One of 0, 3 and 6.
  * @param col Column index of the first cell of a block. One of 0, 3 and 6.
  * @param num Number from 1 to 9.
+ *
+ * @return `false` if the number isn't in the block and can't be placed
+ *     anywhere in it, else `true`.
  *****************************************************************************/
-void select_possible_in_block(int table[][9], int row, int col, int num)
+bool select_possible_in_block(struct sudoku_t *sudoku, int row, int col, int num)
 {
-    if(!allowed_in_block(table, row, col, num))
+    ++sudoku->stats.unit_checks;
+    if(!allowed_in_block(sudoku, row, col, num))
     {
-        return;
+        return true;
     }
 
     int possible_row, possible_col;
@@ -343,11 +469,11 @@ void select_possible_in_block(int table[][9], int row, int col, int num)
     {
         for(int j = col; j < col + 3; ++j)
         {
-            if(table[i][j] == 0 && allowed_at_position(table, i, j, num))
+            if(sudoku->table[i][j] == 0 && allowed_at_position(sudoku, i, j, num))
             {
                 if(count_possible > 0)
                 {
-                    return;
+                    return true;
                 }
                 possible_row = i;
                 possible_col = j;
@@ -357,8 +483,9 @@ void select_possible_in_block(int table[][9], int row, int col, int num)
     }
     if(count_possible == 1)
     {
-        table[possible_row][possible_col] = num;
+        fill_cell(sudoku, possible_row, possible_col, num);
     }
+    return count_possible == 1;
 }
 
 /******************************************************************************
@@ -366,101 +493,696 @@ void select_possible_in_block(int table[][9], int row, int col, int num)
  * a single position is present in a row or column or block, assign it at
  * that/those position/positions. Otherwise, do nothing.
  *
- * @param table Sudoku table.
+ * @param sudoku Sudoku object.
  * @param num Number from 1 to 9.
+ *
+ * @return `false` if there is a row, column or block in which the number
+ *     isn't and can't be placed, else `true`.
  *****************************************************************************/
-void select_possible(int table[][9], int num)
+bool select_possible(struct sudoku_t *sudoku, int num)
 {
     for(int i = 0; i < 9; ++i)
     {
-        select_possible_in_row(table, i, num);
+        if(!select_possible_in_row(sudoku, i, num))
+        {
+            return false;
+        }
     }
     for(int j = 0; j < 9; ++j)
     {
-        select_possible_in_col(table, j, num);
+        if(!select_possible_in_col(sudoku, j, num))
+        {
+            return false;
+        }
     }
     for(int i = 0; i < 9; i += 3)
     {
         for(int j = 0; j < 9; j += 3)
         {
-            select_possible_in_block(table, i, j, num);
+            if(!select_possible_in_block(sudoku, i, j, num))
+            {
+                return false;
+            }
         }
     }
+    return true;
+}
+
+/******************************************************************************
+ * Find and clear the lowest set bit in an array of masks.
+ *
+ * @param pending Array of 9 masks.
+ * @param i Variable to store the index of the mask in.
+ * @param k Variable to store the index of the bit in.
+ *
+ * @return `false` if no bit is set, else `true`.
+ *****************************************************************************/
+static bool pop_pending(int unsigned pending[], int *i, int *k)
+{
+    for(*i = 0; *i < 9; ++*i)
+    {
+        if(pending[*i] != 0)
+        {
+            *k = __builtin_ctz(pending[*i]);
+            pending[*i] &= pending[*i] - 1;
+            return true;
+        }
+    }
+    return false;
 }
 
 /******************************************************************************
  * Do one pass of the table, filling cells wherever possible.
  *
- * @param table Sudoku table.
- * @param assign_random Whether to fill a cell randomly. At most one cell shall
- *     be filled randomly per function call.
+ * @param sudoku Sudoku object.
+ *
+ * @return `false` if the puzzle was found to be unsolvable, else `true`.
  *****************************************************************************/
-void single_pass(int table[][9], bool assign_random)
+bool single_pass(struct sudoku_t *sudoku)
 {
     for(int i = 0; i < 9; ++i)
     {
         for(int j = 0; j < 9; ++j)
         {
-            if(table[i][j] == 0)
+            if(sudoku->table[i][j] == 0 && !select_allowed(sudoku, i, j))
             {
-                select_allowed(table, i, j, assign_random);
-                assign_random = false;
+                return false;
             }
         }
     }
     for(int num = 1; num <= 9; ++num)
     {
-        select_possible(table, num);
+        if(!select_possible(sudoku, num))
+        {
+            return false;
+        }
     }
+    return true;
 }
 
 /******************************************************************************
- * Solve the sudoku puzzle.
+ * Check the cells, rows, columns and blocks marked as having to be checked,
+ * filling cells wherever possible, until none are left.
  *
- * @param table Sudoku table.
+ * @param sudoku Sudoku object.
+ *
+ * @return `false` if the puzzle was found to be unsolvable, else `true`. In
+ *     the former case, some may be left marked.
  *****************************************************************************/
-void solve_sudoku(int table[][9])
+bool propagate(struct sudoku_t *sudoku)
 {
-    int backup[9][9];
-    memcpy(backup, table, sizeof backup);
-
-    int prev_zeros = 81;
-    bool prev_assign_random = false;
+    // Check cells before rows, columns and blocks, because it is cheaper.
+    // Filling a cell marks more of all of them, so start over every time.
     while(true)
     {
-        int zeros = number_of_empty_cells(table);
-        if(zeros == 0)
+        int i, k;
+        if(pop_pending(sudoku->pending_cells, &i, &k))
         {
-            break;
+            if(sudoku->table[i][k] == 0 && !select_allowed(sudoku, i, k))
+            {
+                return false;
+            }
         }
+        else if(pop_pending(sudoku->pending_rows, &i, &k))
+        {
+            if(!select_possible_in_row(sudoku, i, k + 1))
+            {
+                return false;
+            }
+        }
+        else if(pop_pending(sudoku->pending_cols, &i, &k))
+        {
+            if(!select_possible_in_col(sudoku, i, k + 1))
+            {
+                return false;
+            }
+        }
+        else if(pop_pending(sudoku->pending_blocks, &i, &k))
+        {
+            if(!select_possible_in_block(sudoku, i / 3 * 3, i % 3 * 3, k + 1))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return true;
+        }
+    }
+}
+
+// The numbers which may be placed in each cell, as seen by a rule. Bit
+// `num - 1` of `cells[row][col]` is set if and only if the cell at that
+// position is empty and `num` may be placed in it. Bit `col` of
+// `lines[0][num - 1][row]` and bit `row` of `lines[1][num - 1][col]` are set
+// under the same condition.
+struct candidates_t
+{
+    int unsigned cells[9][9];
+    int unsigned lines[2][9][9];
+};
+
+/******************************************************************************
+ * Find the numbers which may be placed in each cell.
+ *
+ * @param sudoku Sudoku object.
+ * @param candidates Variable to store the numbers in.
+ *****************************************************************************/
+static void find_candidates(struct sudoku_t const *sudoku, struct candidates_t *candidates)
+{
+    *candidates = (struct candidates_t){0};
+    for(int row = 0; row < 9; ++row)
+    {
+        for(int col = 0; col < 9; ++col)
+        {
+            if(sudoku->table[row][col] != 0)
+            {
+                continue;
+            }
+            int unsigned allowed = allowed_mask(sudoku, row, col);
+            candidates->cells[row][col] = allowed;
+            for(; allowed != 0; allowed &= allowed - 1)
+            {
+                int i = __builtin_ctz(allowed);
+                candidates->lines[0][i][row] |= 1U << col;
+                candidates->lines[1][i][col] |= 1U << row;
+            }
+        }
+    }
+}
 
-        // If no cells could be filled in an iteration, ask for a number to
-        // be filled in randomly. If that didn't work, give up and try again
-        // from the beginning.
-        bool assign_random = zeros == prev_zeros;
-        if(prev_assign_random && assign_random)
+/******************************************************************************
+ * Eliminate a number from some cells in a row or column.
+ *
+ * @param sudoku Sudoku object.
+ * @param transposed Whether `line` is a column index rather than a row index.
+ * @param line Number from 0 to 8.
+ * @param crossings Mask in which bit `i` is set if the number is to be
+ *     eliminated from the cell in the `i`th column (or row) of the line.
+ * @param bit Mask in which only bit `num - 1` is set.
+ *
+ * @return `true` if the number was allowed in any of the cells, else `false`.
+ *****************************************************************************/
+static bool eliminate_in_line(
+    struct sudoku_t *sudoku, bool transposed, int line, int unsigned crossings, int unsigned bit
+)
+{
+    bool eliminated = false;
+    for(; crossings != 0; crossings &= crossings - 1)
+    {
+        int crossing = __builtin_ctz(crossings);
+        if(transposed)
+        {
+            eliminated |= eliminate(sudoku, crossing, line, bit);
+        }
+        else
+        {
+            eliminated |= eliminate(sudoku, line, crossing, bit);
+        }
+    }
+    return eliminated;
+}
+
+/******************************************************************************
+ * Pointing: if all positions for a number in a block are in the same row (or
+ * column), eliminate the number from the other cells in that row (or column).
+ *
+ * @param sudoku Sudoku object.
+ * @param candidates Numbers which may be placed in each cell.
+ *
+ * @return `true` if any number was eliminated, else `false`.
+ *****************************************************************************/
+static bool apply_pointing(struct sudoku_t *sudoku, struct candidates_t const *candidates)
+{
+    bool eliminated = false;
+    for(int transposed = 0; transposed < 2; ++transposed)
+    {
+        for(int block = 0; block < 9; ++block)
+        {
+            // The block spans three lines starting from `first`, and three
+            // crossings starting from `offset` in each of them.
+            int first = transposed ? block % 3 * 3 : block / 3 * 3;
+            int offset = transposed ? block / 3 * 3 : block % 3 * 3;
+            for(int i = 0; i < 9; ++i)
+            {
+                int unsigned const *lines = candidates->lines[transposed][i];
+                int unsigned spanned = 0;
+                for(int k = 0; k < 3; ++k)
+                {
+                    if((lines[first + k] >> offset & 7U) != 0)
+                    {
+                        spanned |= 1U << k;
+                    }
+                }
+                if(spanned != 0 && (spanned & (spanned - 1)) == 0)
+                {
+                    int line = first + __builtin_ctz(spanned);
+                    int unsigned crossings = lines[line] & ~(7U << offset);
+                    eliminated |= eliminate_in_line(sudoku, transposed, line, crossings, 1U << i);
+                }
+            }
+        }
+    }
+    return eliminated;
+}
+
+/******************************************************************************
+ * Claiming: if all positions for a number in a row (or column) are in the
+ * same block, eliminate the number from the other cells in that block.
+ *
+ * @param sudoku Sudoku object.
+ * @param candidates Numbers which may be placed in each cell.
+ *
+ * @return `true` if any number was eliminated, else `false`.
+ *****************************************************************************/
+static bool apply_claiming(struct sudoku_t *sudoku, struct candidates_t const *candidates)
+{
+    bool eliminated = false;
+    for(int transposed = 0; transposed < 2; ++transposed)
+    {
+        for(int i = 0; i < 9; ++i)
+        {
+            int unsigned const *lines = candidates->lines[transposed][i];
+            for(int line = 0; line < 9; ++line)
+            {
+                // Bit `k` of `spanned` is set if the number may be placed in
+                // the `k`th block the line passes through.
+                int unsigned spanned = 0;
+                for(int k = 0; k < 3; ++k)
+                {
+                    if((lines[line] >> 3 * k & 7U) != 0)
+                    {
+                        spanned |= 1U << k;
+                    }
+                }
+                if(spanned == 0 || (spanned & (spanned - 1)) != 0)
+                {
+                    continue;
+                }
+                int offset = 3 * __builtin_ctz(spanned);
+                for(int other = line / 3 * 3; other < line / 3 * 3 + 3; ++other)
+                {
+                    if(other != line)
+                    {
+                        int unsigned crossings = lines[other] & 7U << offset;
+                        eliminated |= eliminate_in_line(sudoku, transposed, other, crossings, 1U << i);
+                    }
+                }
+            }
+        }
+    }
+    return eliminated;
+}
+
+/******************************************************************************
+ * Find the position of a cell in a row, column or block.
+ *
+ * @param unit Number from 0 to 26. Rows are numbered from 0 to 8, columns
+ *     from 9 to 17 and blocks (in row-major order) from 18 to 26.
+ * @param k Number from 0 to 8. Index of the cell in the unit (in row-major
+ *     order for blocks).
+ *
+ * @return Position (`9 * row + col`).
+ *****************************************************************************/
+static int unit_position(int unit, int k)
+{
+    if(unit < 9)
+    {
+        return 9 * unit + k;
+    }
+    if(unit < 18)
+    {
+        return 9 * k + unit - 9;
+    }
+    unit -= 18;
+    return 9 * (unit / 3 * 3 + k / 3) + unit % 3 * 3 + k % 3;
+}
+
+/******************************************************************************
+ * Naked subsets: if some cells in a row, column or block together allow only
+ * as many numbers as there are cells, eliminate those numbers from the other
+ * cells in it. Hidden subsets: if some numbers together have only as many
+ * positions in a row, column or block as there are numbers, eliminate the
+ * other numbers from those positions.
+ *
+ * @param sudoku Sudoku object.
+ * @param candidates Numbers which may be placed in each cell.
+ * @param size Number of cells or numbers in the subset. 2 for pairs and 3 for
+ *     triples.
+ * @param hidden Whether to look for hidden subsets rather than naked ones.
+ *
+ * @return `true` if any number was eliminated, else `false`.
+ *****************************************************************************/
+static bool apply_subsets(struct sudoku_t *sudoku, struct candidates_t const *candidates, int size, bool hidden)
+{
+    bool eliminated = false;
+    for(int unit = 0; unit < 27; ++unit)
+    {
+        // The members of a naked subset are cells, and bit `num - 1` of the
+        // mask of cell `k` is set if `num` is allowed in it. The members of a
+        // hidden subset are numbers, and bit `k` of the mask of number
+        // `num - 1` is set if it is allowed in cell `k`.
+        int positions[9];
+        int unsigned masks[9] = {0};
+        for(int k = 0; k < 9; ++k)
+        {
+            positions[k] = unit_position(unit, k);
+            int unsigned allowed = candidates->cells[positions[k] / 9][positions[k] % 9];
+            if(!hidden)
+            {
+                masks[k] = allowed;
+                continue;
+            }
+            for(; allowed != 0; allowed &= allowed - 1)
+            {
+                masks[__builtin_ctz(allowed)] |= 1U << k;
+            }
+        }
+        // Only members with at most `size` bits set in their masks can be in a
+        // subset. (Those with none set are filled cells or numbers present.)
+        int eligible[9];
+        int count_eligible = 0;
+        for(int i = 0; i < 9; ++i)
+        {
+            if(masks[i] != 0 && __builtin_popcount(masks[i]) <= size)
+            {
+                eligible[count_eligible++] = i;
+            }
+        }
+
+        // Go through all subsets of eligible members of the given size in
+        // lexicographic order. Bit `j` of `chosen` is set if the member
+        // indexed `eligible[j]` is in the subset.
+        for(int unsigned chosen = (1U << size) - 1; chosen < 1U << count_eligible;)
+        {
+            int unsigned members = 0, combined = 0;
+            for(int unsigned rest = chosen; rest != 0; rest &= rest - 1)
+            {
+                int i = eligible[__builtin_ctz(rest)];
+                members |= 1U << i;
+                combined |= masks[i];
+            }
+            if(__builtin_popcount(combined) == size)
+            {
+                for(int k = 0; k < 9; ++k)
+                {
+                    int row = positions[k] / 9, col = positions[k] % 9;
+                    if(sudoku->table[row][col] != 0)
+                    {
+                        continue;
+                    }
+                    if(!hidden && (members >> k & 1U) == 0)
+                    {
+                        eliminated |= eliminate(sudoku, row, col, combined);
+                    }
+                    if(hidden && (combined >> k & 1U) != 0)
+                    {
+                        eliminated |= eliminate(sudoku, row, col, ~members & 0x1FFU);
+                    }
+                }
+            }
+            int unsigned lowest = chosen & -chosen, ripple = chosen + lowest;
+            chosen = (((ripple ^ chosen) >> 2) / lowest) | ripple;
+        }
+    }
+    return eliminated;
+}
+
+/******************************************************************************
+ * X-Wing: if the positions for a number in two rows (or columns) are in the
+ * same two columns (or rows), eliminate the number from the other cells in
+ * those columns (or rows).
+ *
+ * @param sudoku Sudoku object.
+ * @param candidates Numbers which may be placed in each cell.
+ *
+ * @return `true` if any number was eliminated, else `false`.
+ *****************************************************************************/
+static bool apply_x_wing(struct sudoku_t *sudoku, struct candidates_t const *candidates)
+{
+    bool eliminated = false;
+    for(int transposed = 0; transposed < 2; ++transposed)
+    {
+        for(int i = 0; i < 9; ++i)
+        {
+            int unsigned const *lines = candidates->lines[transposed][i];
+            int unsigned const *crossing_lines = candidates->lines[!transposed][i];
+            for(int line = 0; line < 9; ++line)
+            {
+                if(__builtin_popcount(lines[line]) != 2)
+                {
+                    continue;
+                }
+                for(int other = line + 1; other < 9; ++other)
+                {
+                    if(lines[other] != lines[line])
+                    {
+                        continue;
+                    }
+                    int unsigned ends = 1U << line | 1U << other;
+                    for(int unsigned rest = lines[line]; rest != 0; rest &= rest - 1)
+                    {
+                        int crossing = __builtin_ctz(rest);
+                        int unsigned crossings = crossing_lines[crossing] & ~ends;
+                        eliminated |= eliminate_in_line(sudoku, !transposed, crossing, crossings, 1U << i);
+                    }
+                }
+            }
+        }
+    }
+    return eliminated;
+}
+
+/******************************************************************************
+ * Apply a rule.
+ *
+ * @param sudoku Sudoku object.
+ * @param candidates Numbers which may be placed in each cell.
+ * @param rule Rule.
+ *
+ * @return `true` if any number was eliminated, else `false`.
+ *****************************************************************************/
+static bool apply_rule(struct sudoku_t *sudoku, struct candidates_t const *candidates, enum sudoku_rule_t rule)
+{
+    switch(rule)
+    {
+        case RULE_POINTING:
+            return apply_pointing(sudoku, candidates);
+        case RULE_CLAIMING:
+            return apply_claiming(sudoku, candidates);
+        case RULE_NAKED_PAIRS:
+            return apply_subsets(sudoku, candidates, 2, false);
+        case RULE_HIDDEN_PAIRS:
+            return apply_subsets(sudoku, candidates, 2, true);
+        case RULE_X_WING:
+            return apply_x_wing(sudoku, candidates);
+        case RULE_NAKED_TRIPLES:
+            return apply_subsets(sudoku, candidates, 3, false);
+        case RULE_HIDDEN_TRIPLES:
+            return apply_subsets(sudoku, candidates, 3, true);
+        default:
+            return false;
+    }
+}
+
+/******************************************************************************
+ * Try the rules enabled in order, stopping at the first one which eliminates
+ * any number, because filling cells is cheaper than trying the later rules.
+ * Hence, the board does not change between the rules tried, and they can all
+ * use the same candidates.
+ *
+ * @param sudoku Sudoku object.
+ *
+ * @return `true` if any number was eliminated, else `false`.
+ *****************************************************************************/
+bool apply_rules(struct sudoku_t *sudoku)
+{
+    if(sudoku->options.rules == 0)
+    {
+        return false;
+    }
+    struct candidates_t candidates;
+    find_candidates(sudoku, &candidates);
+    for(int rule = 0; rule < RULES; ++rule)
+    {
+        if((sudoku->options.rules >> rule & 1U) == 0)
         {
-            memcpy(table, backup, sizeof backup);
-            prev_zeros = 81;
-            prev_assign_random = false;
             continue;
         }
-        single_pass(table, assign_random);
-        prev_zeros = zeros;
-        prev_assign_random = assign_random;
+        int eliminations = sudoku->eliminations;
+        bool eliminated;
+        if(sudoku->time_rules)
+        {
+            struct timespec begin, end;
+            clock_gettime(CLOCK_MONOTONIC, &begin);
+            eliminated = apply_rule(sudoku, &candidates, rule);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            int long delay_nano = (int long)(end.tv_sec - begin.tv_sec) * 1000000000 + (end.tv_nsec - begin.tv_nsec);
+            sudoku->stats.rule_nanoseconds[rule] += delay_nano;
+        }
+        else
+        {
+            eliminated = apply_rule(sudoku, &candidates, rule);
+        }
+        ++sudoku->stats.rule_calls[rule];
+        for(int k = eliminations; k < sudoku->eliminations; ++k)
+        {
+            sudoku->stats.rule_eliminations[rule] += __builtin_popcount(sudoku->elimination_trail[k].mask);
+        }
+        if(eliminated)
+        {
+            return true;
+        }
     }
+    return false;
+}
+
+/******************************************************************************
+ * Solve the sudoku puzzle by depth-first search. Fill cells wherever possible,
+ * and apply the rules enabled when no cell can be filled, until they
+ * eliminate nothing. Then guess the number in the cell which has the fewest
+ * numbers allowed, and continue searching. If that makes the puzzle
+ * unsolvable, undo the cells filled since the guess, and try the next number.
+ * The number of guesses is hence bounded, and no work is done twice.
+ *
+ * @param sudoku Sudoku object. If the puzzle is unsolvable, the cells filled
+ *     by this function are not emptied.
+ * @param randomise Whether to guess numbers in a random order (rather than in
+ *     increasing order).
+ *
+ * @return `true` if the puzzle was solved, else `false`.
+ *****************************************************************************/
+bool search_sudoku(struct sudoku_t *sudoku, bool randomise)
+{
+    do
+    {
+        if(sudoku->options.sweep)
+        {
+            int prev_empty;
+            do
+            {
+                prev_empty = sudoku->empty;
+                if(!single_pass(sudoku))
+                {
+                    return false;
+                }
+            }
+            while(sudoku->empty > 0 && sudoku->empty < prev_empty);
+        }
+        else if(!propagate(sudoku))
+        {
+            return false;
+        }
+    }
+    while(sudoku->empty > 0 && apply_rules(sudoku));
+    if(sudoku->empty == 0)
+    {
+        return true;
+    }
+
+    // Since no cell was filled in the last pass, every empty cell has at
+    // least two numbers allowed.
+    int guess_row = 0, guess_col = 0;
+    int unsigned guess_allowed = 0;
+    int count_guess_allowed = 10;
+    for(int i = 0; i < 9 && count_guess_allowed > 2; ++i)
+    {
+        for(int j = 0; j < 9 && count_guess_allowed > 2; ++j)
+        {
+            if(sudoku->table[i][j] != 0)
+            {
+                continue;
+            }
+            int unsigned allowed = allowed_mask(sudoku, i, j);
+            int count_allowed = __builtin_popcount(allowed);
+            if(count_allowed < count_guess_allowed)
+            {
+                guess_row = i;
+                guess_col = j;
+                guess_allowed = allowed;
+                count_guess_allowed = count_allowed;
+            }
+        }
+    }
+
+    int guesses[9];
+    for(int k = 0; k < count_guess_allowed; ++k)
+    {
+        guesses[k] = __builtin_ctz(guess_allowed) + 1;
+        guess_allowed &= guess_allowed - 1;
+    }
+    if(randomise)
+    {
+        mt19937_shuf32(guesses, count_guess_allowed, sizeof *guesses, NULL);
+    }
+    int empty = sudoku->empty;
+    int eliminations = sudoku->eliminations;
+    for(int k = 0; k < count_guess_allowed; ++k)
+    {
+        ++sudoku->stats.guesses;
+        fill_cell(sudoku, guess_row, guess_col, guesses[k]);
+        if(search_sudoku(sudoku, randomise))
+        {
+            return true;
+        }
+        unfill_cells(sudoku, empty);
+        uneliminate(sudoku, eliminations);
+
+        // Nothing could be filled or eliminated before the guess, so only the
+        // effects of the next guess have to be checked.
+        for(int i = 0; i < 9; ++i)
+        {
+            sudoku->pending_cells[i] = 0;
+            sudoku->pending_rows[i] = sudoku->pending_cols[i] = sudoku->pending_blocks[i] = 0;
+        }
+    }
+    return false;
+}
+
+/******************************************************************************
+ * Solve the sudoku puzzle.
+ *
+ * @param table Sudoku table. Must not contain any number twice in any row,
+ *     column or block. If the puzzle is unsolvable, it is not modified.
+ * @param randomise Whether to guess numbers in a random order. If the puzzle
+ *     has multiple solutions, this makes the one found random.
+ * @param options Solver options. If `NULL`, the defaults are used.
+ * @param stats Variable to store the amount of work done in. May be `NULL`,
+ *     in which case the time taken by the rules is not measured.
+ *
+ * @return `true` if the puzzle was solved, else `false`.
+ *****************************************************************************/
+bool solve_sudoku(
+    int table[][9], bool randomise, struct sudoku_options_t const *options, struct sudoku_stats_t *stats
+)
+{
+    struct sudoku_t sudoku;
+    init_sudoku(&sudoku, table, options);
+    sudoku.time_rules = stats != NULL;
+    bool solved = search_sudoku(&sudoku, randomise);
+    if(stats != NULL)
+    {
+        *stats = sudoku.stats;
+    }
+    if(!solved)
+    {
+        return false;
+    }
+    memcpy(table, sudoku.table, sizeof sudoku.table);
+    return true;
 }
 
 /******************************************************************************
  * Generate a sudoku puzzle by solving an empty puzzle and then removing some
- * numbers from it.
+ * numbers from it. The puzzle generated always has a unique solution, so if
+ * the difficulty level is high, fewer numbers may be removed than requested.
  *
  * @param table Sudoku table.
  * @param difficulty Difficulty level on a scale of 0 to 20.
  *****************************************************************************/
 void generate_sudoku(int table[][9], double difficulty)
 {
-    solve_sudoku(table);
+    solve_sudoku(table, true, NULL, NULL);
 
     if(difficulty < 0 || difficulty > 20)
     {
@@ -468,61 +1190,51 @@ void generate_sudoku(int table[][9], double difficulty)
     }
     int deletions = lround(81 * difficulty / 20);
 
-    // Determine how many numbers have to be deleted from each block. The
-    // difference between the number of deletions in any two blocks must be at
-    // most 1.
-    div_t qr = div(deletions, 9);
-    int block_deletions[9];
+    // Shuffle the positions of the cells in each block.
+    int positions[9][9];
     for(int i = 0; i < 9; ++i)
     {
-        block_deletions[i] = qr.quot;
-        if(qr.rem > 0)
+        for(int k = 0; k < 9; ++k)
         {
-            ++block_deletions[i];
-            --qr.rem;
+            positions[i][k] = 9 * (i / 3 * 3 + k / 3) + i % 3 * 3 + k % 3;
         }
+        mt19937_shuf32(positions[i], 9, sizeof *positions[i], NULL);
     }
-    mt19937_shuf32(block_deletions, 9, sizeof *block_deletions, NULL);
 
-    // From each block, randomly delete the determined number of numbers.
-    int indices[][2] = {{0, 0}, {0, 1}, {0, 2}, {1, 0}, {1, 1}, {1, 2}, {2, 0}, {2, 1}, {2, 2}};
-    int block_number = 0;
-    for(int i = 0; i < 9; i += 3)
+    // Delete numbers one at a time, taking one from each block (in a random
+    // order) in turn, so that the deletions are spread evenly over the blocks.
+    // If the puzzle would then have multiple solutions, keep the number.
+    // Deleting more numbers can only add solutions, so such a number could not
+    // be deleted later either; hence, no number needs to be tried twice.
+    int blocks[] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    int deleted = 0;
+    for(int k = 0; k < 9 && deleted < deletions; ++k)
     {
-        for(int j = 0; j < 9; j += 3)
+        mt19937_shuf32(blocks, 9, sizeof *blocks, NULL);
+        for(int i = 0; i < 9 && deleted < deletions; ++i)
         {
-            int backup[9][9];
-            memcpy(backup, table, sizeof backup);
-            mt19937_shuf32(indices, 9, sizeof *indices, NULL);
-            int multiple_solutions_fixes = (difficulty > 13) ? 0 : INT_MAX;
-            for(int k = 0; k < block_deletions[block_number]; ++k)
+            int position = positions[blocks[i]][k];
+            int row = position / 9, col = position % 9;
+            int num = table[row][col];
+            table[row][col] = 0;
+            int puzzle[9][9];
+            memcpy(puzzle, table, sizeof puzzle);
+            if(solve_sudoku_dlx(puzzle, 2) == 1)
             {
-                table[i + indices[k][0]][j + indices[k][1]] = 0;
-                if(multiple_solutions_fixes == 0)
-                {
-                    continue;
-                }
-
-                // As a consequence of deleting this number, does the puzzle
-                // now have multiple solutions? If yes, restart this loop.
-                int puzzle1[9][9], puzzle2[9][9];
-                memcpy(puzzle1, table, sizeof puzzle1);
-                memcpy(puzzle2, table, sizeof puzzle2);
-                solve_sudoku(puzzle1);
-                solve_sudoku(puzzle2);
-                if(memcmp(puzzle1, puzzle2, sizeof puzzle1))
-                {
-                    memcpy(table, backup, sizeof backup);
-                    mt19937_shuf32(indices, 9, sizeof *indices, NULL);
-                    --multiple_solutions_fixes;
-                    k = -1;
-                }
+                ++deleted;
+            }
+            else
+            {
+                table[row][col] = num;
             }
-            ++block_number;
         }
     }
 
     fprintf(stderr, "Difficulty Level: %g/20\n", difficulty);
+    if(deleted < deletions)
+    {
+        fprintf(stderr, "Removed %d numbers instead of %d to keep the solution unique.\n", deleted, deletions);
+    }
     write_sudoku(table);
 }
 
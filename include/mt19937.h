@@ -20,9 +20,38 @@
 #error "This compiler does not support 32- and 64-bit unsigned and signed integers."
 #endif
 
+// Instrumentation counters, available only if both this package and the
+// program using it are compiled with `MT19937_STATS` defined. (Doing so
+// changes the layout of MT19937 objects.)
+#ifdef MT19937_STATS
+struct mt19937_stats_t
+{
+    uint64_t seed;
+    uint64_t init;
+    uint64_t rand;
+    uint64_t uint;
+    uint64_t span;
+    uint64_t real;
+    uint64_t shuf;
+    uint64_t drop;
+    uint64_t back;
+    uint64_t fill;
+    uint64_t twists;
+    uint64_t rejections;
+    uint64_t drop_steps;
+    uint64_t back_steps;
+};
+#endif
+
 // Forward declarations.
 struct mt19937_32_t;
 struct mt19937_64_t;
+struct philox_32_t;
+struct xoshiro256ss_64_t;
+struct xoroshiro128p_64_t;
+struct pcg64_64_t;
+struct dcmt521_32_t;
+struct dcmt2203_32_t;
 #ifdef __cplusplus
 extern "C"
 {
@@ -43,6 +72,81 @@ void mt19937_shuf32(void *items, uint32_t num_of_items, size_t size_of_item, str
 void mt19937_shuf64(void *items, uint64_t num_of_items, size_t size_of_item, struct mt19937_64_t *mt);
 void mt19937_drop32(int long long count, struct mt19937_32_t *mt);
 void mt19937_drop64(int long long count, struct mt19937_64_t *mt);
+void mt19937_back32(int long long count, struct mt19937_32_t *mt);
+void mt19937_back64(int long long count, struct mt19937_64_t *mt);
+void mt19937_fill32(uint32_t *items, size_t num_of_items, struct mt19937_32_t *mt);
+void mt19937_fill64(uint64_t *items, size_t num_of_items, struct mt19937_64_t *mt);
+uint64_t philox_seed32(uint64_t seed, struct philox_32_t *ph);
+uint64_t philox_init32(struct philox_32_t *ph);
+uint32_t philox_rand32(struct philox_32_t *ph);
+uint32_t philox_uint32(uint32_t modulus, struct philox_32_t *ph);
+int32_t philox_span32(int32_t left, int32_t right, struct philox_32_t *ph);
+double philox_real32(struct philox_32_t *ph);
+void philox_shuf32(void *items, uint32_t num_of_items, size_t size_of_item, struct philox_32_t *ph);
+void philox_drop32(int long long count, struct philox_32_t *ph);
+void philox_fill32(uint32_t *items, size_t num_of_items, struct philox_32_t *ph);
+void philox_seek32(uint64_t position, struct philox_32_t *ph);
+uint64_t xoshiro256ss_seed64(uint64_t seed, struct xoshiro256ss_64_t *xs);
+uint64_t xoshiro256ss_init64(struct xoshiro256ss_64_t *xs);
+uint64_t xoshiro256ss_rand64(struct xoshiro256ss_64_t *xs);
+uint64_t xoshiro256ss_uint64(uint64_t modulus, struct xoshiro256ss_64_t *xs);
+int64_t xoshiro256ss_span64(int64_t left, int64_t right, struct xoshiro256ss_64_t *xs);
+double long xoshiro256ss_real64(struct xoshiro256ss_64_t *xs);
+void xoshiro256ss_shuf64(void *items, uint64_t num_of_items, size_t size_of_item, struct xoshiro256ss_64_t *xs);
+void xoshiro256ss_drop64(int long long count, struct xoshiro256ss_64_t *xs);
+void xoshiro256ss_fill64(uint64_t *items, size_t num_of_items, struct xoshiro256ss_64_t *xs);
+void xoshiro256ss_jump64(struct xoshiro256ss_64_t *xs);
+void xoshiro256ss_long_jump64(struct xoshiro256ss_64_t *xs);
+uint64_t xoroshiro128p_seed64(uint64_t seed, struct xoroshiro128p_64_t *xr);
+uint64_t xoroshiro128p_init64(struct xoroshiro128p_64_t *xr);
+uint64_t xoroshiro128p_rand64(struct xoroshiro128p_64_t *xr);
+uint64_t xoroshiro128p_uint64(uint64_t modulus, struct xoroshiro128p_64_t *xr);
+int64_t xoroshiro128p_span64(int64_t left, int64_t right, struct xoroshiro128p_64_t *xr);
+double long xoroshiro128p_real64(struct xoroshiro128p_64_t *xr);
+void xoroshiro128p_shuf64(void *items, uint64_t num_of_items, size_t size_of_item, struct xoroshiro128p_64_t *xr);
+void xoroshiro128p_drop64(int long long count, struct xoroshiro128p_64_t *xr);
+void xoroshiro128p_fill64(uint64_t *items, size_t num_of_items, struct xoroshiro128p_64_t *xr);
+void xoroshiro128p_jump64(struct xoroshiro128p_64_t *xr);
+void xoroshiro128p_long_jump64(struct xoroshiro128p_64_t *xr);
+uint64_t pcg64_seed64(uint64_t seed, struct pcg64_64_t *pc);
+uint64_t pcg64_seed_stream64(uint64_t seed, uint64_t stream, struct pcg64_64_t *pc);
+uint64_t pcg64_init64(struct pcg64_64_t *pc);
+uint64_t pcg64_rand64(struct pcg64_64_t *pc);
+uint64_t pcg64_uint64(uint64_t modulus, struct pcg64_64_t *pc);
+int64_t pcg64_span64(int64_t left, int64_t right, struct pcg64_64_t *pc);
+double long pcg64_real64(struct pcg64_64_t *pc);
+void pcg64_shuf64(void *items, uint64_t num_of_items, size_t size_of_item, struct pcg64_64_t *pc);
+void pcg64_drop64(int long long count, struct pcg64_64_t *pc);
+void pcg64_fill64(uint64_t *items, size_t num_of_items, struct pcg64_64_t *pc);
+void pcg64_advance64(int64_t delta, struct pcg64_64_t *pc);
+int dcmt521_select32(uint32_t set, struct dcmt521_32_t *dc);
+uint32_t dcmt521_seed32(uint32_t seed, struct dcmt521_32_t *dc);
+uint32_t dcmt521_init32(struct dcmt521_32_t *dc);
+uint32_t dcmt521_rand32(struct dcmt521_32_t *dc);
+uint32_t dcmt521_uint32(uint32_t modulus, struct dcmt521_32_t *dc);
+int32_t dcmt521_span32(int32_t left, int32_t right, struct dcmt521_32_t *dc);
+double dcmt521_real32(struct dcmt521_32_t *dc);
+void dcmt521_shuf32(void *items, uint32_t num_of_items, size_t size_of_item, struct dcmt521_32_t *dc);
+void dcmt521_drop32(int long long count, struct dcmt521_32_t *dc);
+void dcmt521_back32(int long long count, struct dcmt521_32_t *dc);
+void dcmt521_fill32(uint32_t *items, size_t num_of_items, struct dcmt521_32_t *dc);
+int dcmt2203_select32(uint32_t set, struct dcmt2203_32_t *dc);
+uint32_t dcmt2203_seed32(uint32_t seed, struct dcmt2203_32_t *dc);
+uint32_t dcmt2203_init32(struct dcmt2203_32_t *dc);
+uint32_t dcmt2203_rand32(struct dcmt2203_32_t *dc);
+uint32_t dcmt2203_uint32(uint32_t modulus, struct dcmt2203_32_t *dc);
+int32_t dcmt2203_span32(int32_t left, int32_t right, struct dcmt2203_32_t *dc);
+double dcmt2203_real32(struct dcmt2203_32_t *dc);
+void dcmt2203_shuf32(void *items, uint32_t num_of_items, size_t size_of_item, struct dcmt2203_32_t *dc);
+void dcmt2203_drop32(int long long count, struct dcmt2203_32_t *dc);
+void dcmt2203_back32(int long long count, struct dcmt2203_32_t *dc);
+void dcmt2203_fill32(uint32_t *items, size_t num_of_items, struct dcmt2203_32_t *dc);
+#ifdef MT19937_STATS
+struct mt19937_stats_t mt19937_stats_get32(struct mt19937_32_t const *mt);
+struct mt19937_stats_t mt19937_stats_get64(struct mt19937_64_t const *mt);
+void mt19937_stats_reset32(struct mt19937_32_t *mt);
+void mt19937_stats_reset64(struct mt19937_64_t *mt);
+#endif
 #ifdef __cplusplus
 }
 #endif
@@ -59,6 +163,8 @@ namespace mt19937
     template<typename... T> double   real32(T... args) { return mt19937_real32(args..., NULL); }
     template<typename... T> void     shuf32(T... args) {        mt19937_shuf32(args..., NULL); }
     template<typename... T> void     drop32(T... args) {        mt19937_drop32(args..., NULL); }
+    template<typename... T> void     back32(T... args) {        mt19937_back32(args..., NULL); }
+    template<typename... T> void     fill32(T... args) {        mt19937_fill32(args..., NULL); }
 
     template<typename... T> uint64_t seed64(T... args) { return mt19937_seed64(args..., NULL); }
     template<typename... T> uint64_t init64(T... args) { return mt19937_init64(args..., NULL); }
@@ -68,6 +174,104 @@ namespace mt19937
     template<typename... T> double   real64(T... args) { return mt19937_real64(args..., NULL); }
     template<typename... T> void     shuf64(T... args) {        mt19937_shuf64(args..., NULL); }
     template<typename... T> void     drop64(T... args) {        mt19937_drop64(args..., NULL); }
+    template<typename... T> void     back64(T... args) {        mt19937_back64(args..., NULL); }
+    template<typename... T> void     fill64(T... args) {        mt19937_fill64(args..., NULL); }
+
+#ifdef MT19937_STATS
+    template<typename... T> mt19937_stats_t stats_get32(T... args) { return mt19937_stats_get32(args..., NULL); }
+    template<typename... T> void stats_reset32(T... args) { mt19937_stats_reset32(args..., NULL); }
+    template<typename... T> mt19937_stats_t stats_get64(T... args) { return mt19937_stats_get64(args..., NULL); }
+    template<typename... T> void stats_reset64(T... args) { mt19937_stats_reset64(args..., NULL); }
+#endif
+};
+
+namespace philox
+{
+    template<typename... T> uint64_t seed32(T... args) { return philox_seed32(args..., NULL); }
+    template<typename... T> uint64_t init32(T... args) { return philox_init32(args..., NULL); }
+    template<typename... T> uint32_t rand32(T... args) { return philox_rand32(args..., NULL); }
+    template<typename... T> uint32_t uint32(T... args) { return philox_uint32(args..., NULL); }
+    template<typename... T> int32_t  span32(T... args) { return philox_span32(args..., NULL); }
+    template<typename... T> double   real32(T... args) { return philox_real32(args..., NULL); }
+    template<typename... T> void     shuf32(T... args) {        philox_shuf32(args..., NULL); }
+    template<typename... T> void     drop32(T... args) {        philox_drop32(args..., NULL); }
+    template<typename... T> void     fill32(T... args) {        philox_fill32(args..., NULL); }
+    template<typename... T> void     seek32(T... args) {        philox_seek32(args..., NULL); }
+};
+
+namespace xoshiro256ss
+{
+    template<typename... T> uint64_t    seed64(T... args) { return xoshiro256ss_seed64(args..., NULL); }
+    template<typename... T> uint64_t    init64(T... args) { return xoshiro256ss_init64(args..., NULL); }
+    template<typename... T> uint64_t    rand64(T... args) { return xoshiro256ss_rand64(args..., NULL); }
+    template<typename... T> uint64_t    uint64(T... args) { return xoshiro256ss_uint64(args..., NULL); }
+    template<typename... T> int64_t     span64(T... args) { return xoshiro256ss_span64(args..., NULL); }
+    template<typename... T> double long real64(T... args) { return xoshiro256ss_real64(args..., NULL); }
+    template<typename... T> void        shuf64(T... args) {        xoshiro256ss_shuf64(args..., NULL); }
+    template<typename... T> void        drop64(T... args) {        xoshiro256ss_drop64(args..., NULL); }
+    template<typename... T> void        fill64(T... args) {        xoshiro256ss_fill64(args..., NULL); }
+    template<typename... T> void        jump64(T... args) {        xoshiro256ss_jump64(args..., NULL); }
+    template<typename... T> void        long_jump64(T... args) {        xoshiro256ss_long_jump64(args..., NULL); }
+};
+
+namespace xoroshiro128p
+{
+    template<typename... T> uint64_t    seed64(T... args) { return xoroshiro128p_seed64(args..., NULL); }
+    template<typename... T> uint64_t    init64(T... args) { return xoroshiro128p_init64(args..., NULL); }
+    template<typename... T> uint64_t    rand64(T... args) { return xoroshiro128p_rand64(args..., NULL); }
+    template<typename... T> uint64_t    uint64(T... args) { return xoroshiro128p_uint64(args..., NULL); }
+    template<typename... T> int64_t     span64(T... args) { return xoroshiro128p_span64(args..., NULL); }
+    template<typename... T> double long real64(T... args) { return xoroshiro128p_real64(args..., NULL); }
+    template<typename... T> void        shuf64(T... args) {        xoroshiro128p_shuf64(args..., NULL); }
+    template<typename... T> void        drop64(T... args) {        xoroshiro128p_drop64(args..., NULL); }
+    template<typename... T> void        fill64(T... args) {        xoroshiro128p_fill64(args..., NULL); }
+    template<typename... T> void        jump64(T... args) {        xoroshiro128p_jump64(args..., NULL); }
+    template<typename... T> void        long_jump64(T... args) {        xoroshiro128p_long_jump64(args..., NULL); }
+};
+
+namespace pcg64
+{
+    template<typename... T> uint64_t    seed64(T... args) { return pcg64_seed64(args..., NULL); }
+    template<typename... T> uint64_t    seed_stream64(T... args) { return pcg64_seed_stream64(args..., NULL); }
+    template<typename... T> uint64_t    init64(T... args) { return pcg64_init64(args..., NULL); }
+    template<typename... T> uint64_t    rand64(T... args) { return pcg64_rand64(args..., NULL); }
+    template<typename... T> uint64_t    uint64(T... args) { return pcg64_uint64(args..., NULL); }
+    template<typename... T> int64_t     span64(T... args) { return pcg64_span64(args..., NULL); }
+    template<typename... T> double long real64(T... args) { return pcg64_real64(args..., NULL); }
+    template<typename... T> void        shuf64(T... args) {        pcg64_shuf64(args..., NULL); }
+    template<typename... T> void        drop64(T... args) {        pcg64_drop64(args..., NULL); }
+    template<typename... T> void        fill64(T... args) {        pcg64_fill64(args..., NULL); }
+    template<typename... T> void        advance64(T... args) {        pcg64_advance64(args..., NULL); }
+};
+
+namespace dcmt521
+{
+    template<typename... T> int      select32(T... args) { return dcmt521_select32(args..., NULL); }
+    template<typename... T> uint32_t seed32(T... args) { return dcmt521_seed32(args..., NULL); }
+    template<typename... T> uint32_t init32(T... args) { return dcmt521_init32(args..., NULL); }
+    template<typename... T> uint32_t rand32(T... args) { return dcmt521_rand32(args..., NULL); }
+    template<typename... T> uint32_t uint32(T... args) { return dcmt521_uint32(args..., NULL); }
+    template<typename... T> int32_t  span32(T... args) { return dcmt521_span32(args..., NULL); }
+    template<typename... T> double   real32(T... args) { return dcmt521_real32(args..., NULL); }
+    template<typename... T> void     shuf32(T... args) {        dcmt521_shuf32(args..., NULL); }
+    template<typename... T> void     drop32(T... args) {        dcmt521_drop32(args..., NULL); }
+    template<typename... T> void     back32(T... args) {        dcmt521_back32(args..., NULL); }
+    template<typename... T> void     fill32(T... args) {        dcmt521_fill32(args..., NULL); }
+};
+
+namespace dcmt2203
+{
+    template<typename... T> int      select32(T... args) { return dcmt2203_select32(args..., NULL); }
+    template<typename... T> uint32_t seed32(T... args) { return dcmt2203_seed32(args..., NULL); }
+    template<typename... T> uint32_t init32(T... args) { return dcmt2203_init32(args..., NULL); }
+    template<typename... T> uint32_t rand32(T... args) { return dcmt2203_rand32(args..., NULL); }
+    template<typename... T> uint32_t uint32(T... args) { return dcmt2203_uint32(args..., NULL); }
+    template<typename... T> int32_t  span32(T... args) { return dcmt2203_span32(args..., NULL); }
+    template<typename... T> double   real32(T... args) { return dcmt2203_real32(args..., NULL); }
+    template<typename... T> void     shuf32(T... args) {        dcmt2203_shuf32(args..., NULL); }
+    template<typename... T> void     drop32(T... args) {        dcmt2203_drop32(args..., NULL); }
+    template<typename... T> void     back32(T... args) {        dcmt2203_back32(args..., NULL); }
+    template<typename... T> void     fill32(T... args) {        dcmt2203_fill32(args..., NULL); }
 };
 #endif
 
@@ -77,6 +281,9 @@ struct mt19937_32_t
     uint32_t state[624];
     uint32_t value[624];
     int index;
+#ifdef MT19937_STATS
+    struct mt19937_stats_t stats;
+#endif
 #ifdef __cplusplus
     template<typename... T> uint32_t seed32(T... args) { return mt19937_seed32(args..., this); }
     template<typename... T> uint32_t init32(T... args) { return mt19937_init32(args..., this); }
@@ -86,6 +293,12 @@ struct mt19937_32_t
     template<typename... T> double   real32(T... args) { return mt19937_real32(args..., this); }
     template<typename... T> void     shuf32(T... args) {        mt19937_shuf32(args..., this); }
     template<typename... T> void     drop32(T... args) {        mt19937_drop32(args..., this); }
+    template<typename... T> void     back32(T... args) {        mt19937_back32(args..., this); }
+    template<typename... T> void     fill32(T... args) {        mt19937_fill32(args..., this); }
+#ifdef MT19937_STATS
+    template<typename... T> mt19937_stats_t stats_get32(T... args) { return mt19937_stats_get32(args..., this); }
+    template<typename... T> void stats_reset32(T... args) { mt19937_stats_reset32(args..., this); }
+#endif
     mt19937_32_t(uint32_t seed=5489) { this->seed32(seed); }
     mt19937_32_t(std::nullptr_t _) { this->init32(); }
 #endif
@@ -95,6 +308,9 @@ struct mt19937_64_t
     uint64_t state[312];
     uint64_t value[312];
     int index;
+#ifdef MT19937_STATS
+    struct mt19937_stats_t stats;
+#endif
 #ifdef __cplusplus
     template<typename... T> uint64_t seed64(T... args) { return mt19937_seed64(args..., this); }
     template<typename... T> uint64_t init64(T... args) { return mt19937_init64(args..., this); }
@@ -104,11 +320,147 @@ struct mt19937_64_t
     template<typename... T> double   real64(T... args) { return mt19937_real64(args..., this); }
     template<typename... T> void     shuf64(T... args) {        mt19937_shuf64(args..., this); }
     template<typename... T> void     drop64(T... args) {        mt19937_drop64(args..., this); }
+    template<typename... T> void     back64(T... args) {        mt19937_back64(args..., this); }
+    template<typename... T> void     fill64(T... args) {        mt19937_fill64(args..., this); }
+#ifdef MT19937_STATS
+    template<typename... T> mt19937_stats_t stats_get64(T... args) { return mt19937_stats_get64(args..., this); }
+    template<typename... T> void stats_reset64(T... args) { mt19937_stats_reset64(args..., this); }
+#endif
     mt19937_64_t(uint64_t seed=5489) { this->seed64(seed); }
     mt19937_64_t(std::nullptr_t _) { this->init64(); }
 #endif
 };
 
+struct philox_32_t
+{
+    uint32_t key[2];
+    uint32_t counter[4];
+    uint32_t value[4];
+    int index;
+#ifdef __cplusplus
+    template<typename... T> uint64_t seed32(T... args) { return philox_seed32(args..., this); }
+    template<typename... T> uint64_t init32(T... args) { return philox_init32(args..., this); }
+    template<typename... T> uint32_t rand32(T... args) { return philox_rand32(args..., this); }
+    template<typename... T> uint32_t uint32(T... args) { return philox_uint32(args..., this); }
+    template<typename... T> int32_t  span32(T... args) { return philox_span32(args..., this); }
+    template<typename... T> double   real32(T... args) { return philox_real32(args..., this); }
+    template<typename... T> void     shuf32(T... args) {        philox_shuf32(args..., this); }
+    template<typename... T> void     drop32(T... args) {        philox_drop32(args..., this); }
+    template<typename... T> void     fill32(T... args) {        philox_fill32(args..., this); }
+    template<typename... T> void     seek32(T... args) {        philox_seek32(args..., this); }
+    philox_32_t(uint64_t seed=5489) { this->seed32(seed); }
+    philox_32_t(std::nullptr_t) { this->init32(); }
+#endif
+};
+
+struct xoshiro256ss_64_t
+{
+    uint64_t state[4];
+#ifdef __cplusplus
+    template<typename... T> uint64_t    seed64(T... args) { return xoshiro256ss_seed64(args..., this); }
+    template<typename... T> uint64_t    init64(T... args) { return xoshiro256ss_init64(args..., this); }
+    template<typename... T> uint64_t    rand64(T... args) { return xoshiro256ss_rand64(args..., this); }
+    template<typename... T> uint64_t    uint64(T... args) { return xoshiro256ss_uint64(args..., this); }
+    template<typename... T> int64_t     span64(T... args) { return xoshiro256ss_span64(args..., this); }
+    template<typename... T> double long real64(T... args) { return xoshiro256ss_real64(args..., this); }
+    template<typename... T> void        shuf64(T... args) {        xoshiro256ss_shuf64(args..., this); }
+    template<typename... T> void        drop64(T... args) {        xoshiro256ss_drop64(args..., this); }
+    template<typename... T> void        fill64(T... args) {        xoshiro256ss_fill64(args..., this); }
+    template<typename... T> void        jump64(T... args) {        xoshiro256ss_jump64(args..., this); }
+    template<typename... T> void        long_jump64(T... args) {        xoshiro256ss_long_jump64(args..., this); }
+    xoshiro256ss_64_t(uint64_t seed=5489) { this->seed64(seed); }
+    xoshiro256ss_64_t(std::nullptr_t) { this->init64(); }
+#endif
+};
+
+struct xoroshiro128p_64_t
+{
+    uint64_t state[2];
+#ifdef __cplusplus
+    template<typename... T> uint64_t    seed64(T... args) { return xoroshiro128p_seed64(args..., this); }
+    template<typename... T> uint64_t    init64(T... args) { return xoroshiro128p_init64(args..., this); }
+    template<typename... T> uint64_t    rand64(T... args) { return xoroshiro128p_rand64(args..., this); }
+    template<typename... T> uint64_t    uint64(T... args) { return xoroshiro128p_uint64(args..., this); }
+    template<typename... T> int64_t     span64(T... args) { return xoroshiro128p_span64(args..., this); }
+    template<typename... T> double long real64(T... args) { return xoroshiro128p_real64(args..., this); }
+    template<typename... T> void        shuf64(T... args) {        xoroshiro128p_shuf64(args..., this); }
+    template<typename... T> void        drop64(T... args) {        xoroshiro128p_drop64(args..., this); }
+    template<typename... T> void        fill64(T... args) {        xoroshiro128p_fill64(args..., this); }
+    template<typename... T> void        jump64(T... args) {        xoroshiro128p_jump64(args..., this); }
+    template<typename... T> void        long_jump64(T... args) {        xoroshiro128p_long_jump64(args..., this); }
+    xoroshiro128p_64_t(uint64_t seed=5489) { this->seed64(seed); }
+    xoroshiro128p_64_t(std::nullptr_t) { this->init64(); }
+#endif
+};
+
+struct pcg64_64_t
+{
+    uint64_t state[2];
+    uint64_t increment[2];
+#ifdef __cplusplus
+    template<typename... T> uint64_t    seed64(T... args) { return pcg64_seed64(args..., this); }
+    template<typename... T> uint64_t    seed_stream64(T... args) { return pcg64_seed_stream64(args..., this); }
+    template<typename... T> uint64_t    init64(T... args) { return pcg64_init64(args..., this); }
+    template<typename... T> uint64_t    rand64(T... args) { return pcg64_rand64(args..., this); }
+    template<typename... T> uint64_t    uint64(T... args) { return pcg64_uint64(args..., this); }
+    template<typename... T> int64_t     span64(T... args) { return pcg64_span64(args..., this); }
+    template<typename... T> double long real64(T... args) { return pcg64_real64(args..., this); }
+    template<typename... T> void        shuf64(T... args) {        pcg64_shuf64(args..., this); }
+    template<typename... T> void        drop64(T... args) {        pcg64_drop64(args..., this); }
+    template<typename... T> void        fill64(T... args) {        pcg64_fill64(args..., this); }
+    template<typename... T> void        advance64(T... args) {        pcg64_advance64(args..., this); }
+    pcg64_64_t(uint64_t seed=5489) { this->seed64(seed); }
+    pcg64_64_t(uint64_t seed, uint64_t stream) { this->seed_stream64(seed, stream); }
+    pcg64_64_t(std::nullptr_t) { this->init64(); }
+#endif
+};
+
+struct dcmt521_32_t
+{
+    uint32_t state[17];
+    uint32_t value[17];
+    int index;
+    uint32_t twist;
+#ifdef __cplusplus
+    template<typename... T> int      select32(T... args) { return dcmt521_select32(args..., this); }
+    template<typename... T> uint32_t seed32(T... args) { return dcmt521_seed32(args..., this); }
+    template<typename... T> uint32_t init32(T... args) { return dcmt521_init32(args..., this); }
+    template<typename... T> uint32_t rand32(T... args) { return dcmt521_rand32(args..., this); }
+    template<typename... T> uint32_t uint32(T... args) { return dcmt521_uint32(args..., this); }
+    template<typename... T> int32_t  span32(T... args) { return dcmt521_span32(args..., this); }
+    template<typename... T> double   real32(T... args) { return dcmt521_real32(args..., this); }
+    template<typename... T> void     shuf32(T... args) {        dcmt521_shuf32(args..., this); }
+    template<typename... T> void     drop32(T... args) {        dcmt521_drop32(args..., this); }
+    template<typename... T> void     back32(T... args) {        dcmt521_back32(args..., this); }
+    template<typename... T> void     fill32(T... args) {        dcmt521_fill32(args..., this); }
+    dcmt521_32_t(uint32_t set=0, uint32_t seed=5489) { this->select32(set); this->seed32(seed); }
+    dcmt521_32_t(uint32_t set, std::nullptr_t) { this->select32(set); this->init32(); }
+#endif
+};
+
+struct dcmt2203_32_t
+{
+    uint32_t state[69];
+    uint32_t value[69];
+    int index;
+    uint32_t twist;
+#ifdef __cplusplus
+    template<typename... T> int      select32(T... args) { return dcmt2203_select32(args..., this); }
+    template<typename... T> uint32_t seed32(T... args) { return dcmt2203_seed32(args..., this); }
+    template<typename... T> uint32_t init32(T... args) { return dcmt2203_init32(args..., this); }
+    template<typename... T> uint32_t rand32(T... args) { return dcmt2203_rand32(args..., this); }
+    template<typename... T> uint32_t uint32(T... args) { return dcmt2203_uint32(args..., this); }
+    template<typename... T> int32_t  span32(T... args) { return dcmt2203_span32(args..., this); }
+    template<typename... T> double   real32(T... args) { return dcmt2203_real32(args..., this); }
+    template<typename... T> void     shuf32(T... args) {        dcmt2203_shuf32(args..., this); }
+    template<typename... T> void     drop32(T... args) {        dcmt2203_drop32(args..., this); }
+    template<typename... T> void     back32(T... args) {        dcmt2203_back32(args..., this); }
+    template<typename... T> void     fill32(T... args) {        dcmt2203_fill32(args..., this); }
+    dcmt2203_32_t(uint32_t set=0, uint32_t seed=5489) { this->select32(set); this->seed32(seed); }
+    dcmt2203_32_t(uint32_t set, std::nullptr_t) { this->select32(set); this->init32(); }
+#endif
+};
+
 #ifdef __cplusplus
 #undef uint32_t
 #undef uint64_t
@@ -0,0 +1,67 @@
+/******************************************************************************
+ * Functions which need nothing but a function to generate uniform pseudorandom
+ * words, and hence are the same for every generator. Before including this
+ * file, define `MT19937_RAND` (and the other macros it uses) for the generator
+ * being instantiated.
+ *****************************************************************************/
+
+MT19937_CLONES
+MT19937_WORD MT19937_UINT(MT19937_WORD modulus, MT19937_OBJECT_TYPE *mt)
+{
+    MT19937_STATS_SELECT(mt)
+    MT19937_STATS_COUNT(uint, 1);
+    MT19937_WORD upper = MT19937_WORD_MAX - MT19937_WORD_MAX % modulus;
+    MT19937_WORD r = MT19937_RAND(mt);
+    while(r >= upper)
+    {
+        MT19937_STATS_COUNT(rejections, 1);
+        r = MT19937_RAND(mt);
+    }
+    return r % modulus;
+}
+
+
+MT19937_WORD_SIGNED MT19937_SPAN(MT19937_WORD_SIGNED left, MT19937_WORD_SIGNED right, MT19937_OBJECT_TYPE *mt)
+{
+    MT19937_STATS_SELECT(mt)
+    MT19937_STATS_COUNT(span, 1);
+    // Signed exact-width integer types are required to use two's complement
+    // representation. This code will always work.
+    MT19937_WORD uleft = (MT19937_WORD)left;
+    MT19937_WORD uright = (MT19937_WORD)right;
+    MT19937_WORD modulus = uright - uleft;
+    MT19937_WORD r = MT19937_UINT(modulus, mt);
+    return (MT19937_WORD_SIGNED)(r + uleft);
+}
+
+
+MT19937_REAL_TYPE MT19937_REAL(MT19937_OBJECT_TYPE *mt)
+{
+    MT19937_STATS_SELECT(mt)
+    MT19937_STATS_COUNT(real, 1);
+    return (MT19937_REAL_TYPE)MT19937_RAND(mt) / MT19937_WORD_MAX;
+}
+
+
+void MT19937_SHUF(void *items, MT19937_WORD num_of_items, size_t size_of_item, MT19937_OBJECT_TYPE *mt)
+{
+    MT19937_STATS_SELECT(mt)
+    MT19937_STATS_COUNT(shuf, 1);
+    MT19937_PROBE4(shuf_start, MT19937_WORD_WIDTH, mt == NULL ? &MT19937_OBJECT : mt, num_of_items, size_of_item);
+    char unsigned *tmp = malloc(size_of_item);
+    char unsigned *items_ = items;
+    for(MT19937_WORD i = num_of_items - 1; i > 0; --i)
+    {
+        MT19937_WORD j = MT19937_UINT(i + 1, mt);
+        if(i != j)
+        {
+            char unsigned *items_i = items_ + i * size_of_item;
+            char unsigned *items_j = items_ + j * size_of_item;
+            memcpy(tmp, items_i, size_of_item);
+            memcpy(items_i, items_j, size_of_item);
+            memcpy(items_j, tmp, size_of_item);
+        }
+    }
+    free(tmp);
+    MT19937_PROBE2(shuf_end, MT19937_WORD_WIDTH, mt == NULL ? &MT19937_OBJECT : mt);
+}
@@ -0,0 +1,16 @@
+/******************************************************************************
+ * Functions of Mersenne Twisters whose twist matrix is one of several found by
+ * the Dynamic Creator. The other functions are those of MT19937, with
+ * `MT19937_MASK_TWIST` defined to be the twist matrix of the object.
+ *****************************************************************************/
+
+int MT19937_SELECT(uint32_t set, MT19937_OBJECT_TYPE *mt)
+{
+    if(set >= sizeof DCMT_TWISTS / sizeof *DCMT_TWISTS)
+    {
+        return -1;
+    }
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    mt->twist = DCMT_TWISTS[set];
+    return 0;
+}
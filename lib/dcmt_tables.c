@@ -0,0 +1,556 @@
+/******************************************************************************
+ * Twist matrices of MT521 and MT2203 found by `tools/dcmt`. (Run `make table`
+ * there to regenerate this file.) The least significant 16 bits of each are
+ * its index.
+ *****************************************************************************/
+static uint32_t const dcmt521_twists[] =
+{
+    0x9E760000U, 0xDA4E0001U, 0xFADC0002U, 0xE3C50003U, 0xEAF10004U, 0x8FAA0005U, 0xAC540006U, 0x953E0007U,
+    0x927A0008U, 0xF7070009U, 0xF18F000AU, 0xCA58000BU, 0x8E2F000CU, 0x9144000DU, 0xC828000EU, 0xDA08000FU,
+    0xCC590010U, 0xD5090011U, 0xFC060012U, 0xEF0A0013U, 0xB2490014U, 0xAF7F0015U, 0x900B0016U, 0xCA000017U,
+    0xE66B0018U, 0xC8A20019U, 0x9BD9001AU, 0xF0BE001BU, 0xCA12001CU, 0xD917001DU, 0x9F25001EU, 0xD620001FU,
+    0xE8460020U, 0xD1920021U, 0xEABE0022U, 0xABD10023U, 0xBBD00024U, 0xFEBC0025U, 0xAB210026U, 0xA6690027U,
+    0xEF5E0028U, 0x82CF0029U, 0x92C1002AU, 0xCF19002BU, 0x9CB4002CU, 0x8EFD002DU, 0x88FA002EU, 0xCD3C002FU,
+    0xC3190030U, 0xBF180031U, 0x9FFA0032U, 0xF6130033U, 0xA0F60034U, 0xC8550035U, 0x97720036U, 0xC2AD0037U,
+    0xE9700038U, 0x921B0039U, 0x8140003AU, 0xE262003BU, 0xDB7C003CU, 0xBFB1003DU, 0xF0B1003EU, 0xCA67003FU,
+    0xA2790040U, 0x98D70041U, 0xDB1D0042U, 0xC7F50043U, 0xE72E0044U, 0xFE300045U, 0xD8BD0046U, 0xAC250047U,
+    0x96190048U, 0xE5260049U, 0xEC9B004AU, 0xC78C004BU, 0xD2DA004CU, 0xC4AB004DU, 0xC662004EU, 0xB6CE004FU,
+    0x9A290050U, 0x83A70051U, 0x86930052U, 0xE8BD0053U, 0xBECA0054U, 0xE2A70055U, 0xE1C40056U, 0xA2220057U,
+    0x94B90058U, 0xD7130059U, 0xDD11005AU, 0xA6F8005BU, 0x9146005CU, 0xEB3C005DU, 0xB7D3005EU, 0xEBDC005FU,
+    0x8E130060U, 0x88E20061U, 0xBE930062U, 0x99A90063U, 0xA65C0064U, 0xE2980065U, 0xCAB50066U, 0xCC300067U,
+    0xF3D30068U, 0x95960069U, 0xEB0A006AU, 0x8A5D006BU, 0xED6F006CU, 0x81C4006DU, 0xD597006EU, 0xF6A3006FU,
+    0xE7240070U, 0x93670071U, 0xBB0B0072U, 0x83A40073U, 0xA2620074U, 0xD3E40075U, 0x85140076U, 0xB7AB0077U,
+    0x8B3B0078U, 0xDB7C0079U, 0xF929007AU, 0x8802007BU, 0x9317007CU, 0x9594007DU, 0xA156007EU, 0xEB58007FU,
+    0xF09B0080U, 0xC0470081U, 0x901D0082U, 0xAD8D0083U, 0xD55A0084U, 0xA7A20085U, 0x89760086U, 0xA0D00087U,
+    0x92A90088U, 0xF1A90089U, 0xB956008AU, 0xA97D008BU, 0xA51A008CU, 0x877B008DU, 0xDDA0008EU, 0x983C008FU,
+    0xF86E0090U, 0x9D9E0091U, 0xBA510092U, 0xB8900093U, 0x84AE0094U, 0xEF0C0095U, 0xA9340096U, 0x947F0097U,
+    0xB7D00098U, 0xCB7D0099U, 0xE1C0009AU, 0xEF19009BU, 0x983D009CU, 0xE50E009DU, 0x911C009EU, 0xD787009FU,
+    0x9F3C00A0U, 0x87C000A1U, 0x8B8700A2U, 0xAC0900A3U, 0x810F00A4U, 0x85EA00A5U, 0xAF6900A6U, 0xAFE800A7U,
+    0xFDF700A8U, 0xDFA600A9U, 0xAE5F00AAU, 0xF9B300ABU, 0xF9B400ACU, 0xDB0E00ADU, 0xA76C00AEU, 0xB1D400AFU,
+    0x81D400B0U, 0xE7AB00B1U, 0xA13E00B2U, 0xE22500B3U, 0xEE1600B4U, 0xE35100B5U, 0xE3CF00B6U, 0xB06700B7U,
+    0x972E00B8U, 0xCC2900B9U, 0x9C4600BAU, 0xDD1300BBU, 0x918A00BCU, 0xC3AA00BDU, 0xE1F600BEU, 0xC31B00BFU,
+    0x8B9C00C0U, 0xC11E00C1U, 0x87FC00C2U, 0xA31A00C3U, 0xF70600C4U, 0xB7C700C5U, 0xD3B500C6U, 0x88AB00C7U,
+    0x80E800C8U, 0xBC7E00C9U, 0xC10100CAU, 0xE5F100CBU, 0x810200CCU, 0x8E5A00CDU, 0x9CEB00CEU, 0xABFD00CFU,
+    0xCCDD00D0U, 0xC28800D1U, 0x8ED500D2U, 0x938600D3U, 0xA32700D4U, 0xC97400D5U, 0xBDF100D6U, 0xDACC00D7U,
+    0xAD4C00D8U, 0x974C00D9U, 0xF13500DAU, 0xEB7600DBU, 0xCE5900DCU, 0xFCBB00DDU, 0xF90100DEU, 0xA05F00DFU,
+    0xF94300E0U, 0xA82400E1U, 0xF22900E2U, 0xD1AB00E3U, 0x81C300E4U, 0xD60600E5U, 0xDEB200E6U, 0xDF7F00E7U,
+    0xBFFE00E8U, 0xD70C00E9U, 0xB18800EAU, 0xCABE00EBU, 0x85B100ECU, 0xFC4100EDU, 0xFC8A00EEU, 0xB81B00EFU,
+    0xB34300F0U, 0xE83F00F1U, 0x8F0200F2U, 0xE2D100F3U, 0xA97200F4U, 0xC8CA00F5U, 0xB6B100F6U, 0x842300F7U,
+    0xD2E200F8U, 0xD52500F9U, 0xC90300FAU, 0xF6C900FBU, 0xE58000FCU, 0x8CBF00FDU, 0xD22000FEU, 0xB57900FFU,
+    0xA2800100U, 0xAFFD0101U, 0xEF9C0102U, 0x9B2E0103U, 0xDC350104U, 0xC1700105U, 0xDEE10106U, 0xD9380107U,
+    0xDCB20108U, 0xEACF0109U, 0xD34C010AU, 0xB8FD010BU, 0xFE28010CU, 0xF708010DU, 0xB5D9010EU, 0x8D29010FU,
+    0xBC770110U, 0x99B00111U, 0xD6870112U, 0xA5930113U, 0xA7180114U, 0xC2CD0115U, 0x99490116U, 0x83790117U,
+    0xA1B70118U, 0xB7C00119U, 0x8BC7011AU, 0xB66E011BU, 0xEACC011CU, 0xAE16011DU, 0xB5DD011EU, 0x94BD011FU,
+    0xCF390120U, 0xC2080121U, 0x9F770122U, 0xE8A60123U, 0xC8590124U, 0xDD230125U, 0x94F10126U, 0xDC0A0127U,
+    0x95A50128U, 0x9C680129U, 0xFD2D012AU, 0xE014012BU, 0x9094012CU, 0xF96E012DU, 0x8163012EU, 0x8110012FU,
+    0xCC620130U, 0xD8000131U, 0xA0AD0132U, 0xA3680133U, 0xB7E70134U, 0xABDF0135U, 0xF4280136U, 0x9FDF0137U,
+    0xAD880138U, 0xAF310139U, 0xE03D013AU, 0xCA6F013BU, 0x9A62013CU, 0xC6ED013DU, 0xF28C013EU, 0xE6F5013FU,
+    0x95FE0140U, 0x9AB80141U, 0xDB950142U, 0xB5670143U, 0xC9990144U, 0xF75B0145U, 0x80090146U, 0xE7490147U,
+    0xFE0A0148U, 0xD27C0149U, 0xF0B5014AU, 0xEF2B014BU, 0xF56A014CU, 0x958A014DU, 0x8965014EU, 0xB920014FU,
+    0x89DA0150U, 0x937F0151U, 0xD5470152U, 0xB27A0153U, 0xDC2F0154U, 0xF38E0155U, 0xDA5C0156U, 0xF6520157U,
+    0xCE670158U, 0xE2B70159U, 0x9E0D015AU, 0xFD3F015BU, 0xAF4A015CU, 0xF18F015DU, 0x87DF015EU, 0xFB15015FU,
+    0xA18E0160U, 0xDA690161U, 0xFCF00162U, 0xEE150163U, 0x982D0164U, 0x985E0165U, 0xB3910166U, 0xA8C60167U,
+    0xCAC80168U, 0x9EC50169U, 0xD3F7016AU, 0x86CD016BU, 0xB3D4016CU, 0xB412016DU, 0xD32D016EU, 0xBEE1016FU,
+    0xEEB50170U, 0xA63A0171U, 0xE92D0172U, 0x85990173U, 0xA05E0174U, 0xA2290175U, 0x8BE50176U, 0xD46E0177U,
+    0xBC6F0178U, 0xA35B0179U, 0x8352017AU, 0xA06A017BU, 0xCFC8017CU, 0xB99E017DU, 0xC9F0017EU, 0x8434017FU,
+    0xF8040180U, 0x9AC70181U, 0xEEAC0182U, 0xD0D30183U, 0xB2EC0184U, 0xFEFB0185U, 0x82640186U, 0x839D0187U,
+    0xDBE60188U, 0xBD800189U, 0xA0C4018AU, 0x8427018BU, 0xDAEC018CU, 0xCD82018DU, 0x83E6018EU, 0xE581018FU,
+    0xFCC10190U, 0x89E70191U, 0xCF3E0192U, 0x9E4C0193U, 0x85980194U, 0xAEC70195U, 0xB4180196U, 0x9EC30197U,
+    0xC2980198U, 0x97AC0199U, 0xCE1D019AU, 0x9DF8019BU, 0x847A019CU, 0xA809019DU, 0xFA0B019EU, 0x8271019FU,
+    0xDACA01A0U, 0xD6E501A1U, 0xCF7A01A2U, 0x81A601A3U, 0xC7FA01A4U, 0xB77A01A5U, 0x9C8F01A6U, 0xD96901A7U,
+    0xB1CF01A8U, 0xC1B401A9U, 0xE8D901AAU, 0xB9CF01ABU, 0xD08901ACU, 0xE40D01ADU, 0xBECC01AEU, 0x92FF01AFU,
+    0xFACC01B0U, 0xC34B01B1U, 0xA29A01B2U, 0xD2D301B3U, 0x9EF101B4U, 0x9B1B01B5U, 0xA5E501B6U, 0xE4F801B7U,
+    0xBF4701B8U, 0xDAE901B9U, 0xB45001BAU, 0xF66C01BBU, 0xB43401BCU, 0xDBBA01BDU, 0xE81201BEU, 0xF0B501BFU,
+    0xCD9001C0U, 0xDE7401C1U, 0xBD9301C2U, 0xBF0101C3U, 0xDCD601C4U, 0xFBFF01C5U, 0xB18501C6U, 0x863C01C7U,
+    0xF82F01C8U, 0xF3ED01C9U, 0x90BE01CAU, 0xC35701CBU, 0xD31A01CCU, 0xFFC801CDU, 0xAD7701CEU, 0xB07501CFU,
+    0xC99201D0U, 0x931D01D1U, 0xE64B01D2U, 0x944B01D3U, 0xB9FE01D4U, 0x891A01D5U, 0xC55B01D6U, 0xC8DA01D7U,
+    0xC93301D8U, 0x945001D9U, 0xA51501DAU, 0xAADC01DBU, 0x93F001DCU, 0x910901DDU, 0xD2CF01DEU, 0xDA0F01DFU,
+    0xCE6801E0U, 0xB15201E1U, 0xA2A701E2U, 0xBA6601E3U, 0x8EF301E4U, 0xEA3501E5U, 0x8F7201E6U, 0xEEC101E7U,
+    0xD09701E8U, 0xCC0801E9U, 0x872201EAU, 0xC2EF01EBU, 0xB76F01ECU, 0xFDBD01EDU, 0xC32401EEU, 0xBFE501EFU,
+    0xE64201F0U, 0xCBF501F1U, 0xF6B201F2U, 0xC49901F3U, 0xDBFD01F4U, 0x873801F5U, 0xD06101F6U, 0x8F6C01F7U,
+    0x87E201F8U, 0xDE7601F9U, 0xBFE301FAU, 0xDEB701FBU, 0xBC2901FCU, 0xFD7C01FDU, 0x8DA001FEU, 0xB57701FFU,
+    0xBCA60200U, 0x8EA00201U, 0xF5FE0202U, 0x82FE0203U, 0xFBD00204U, 0x9D530205U, 0xBADC0206U, 0x8ADF0207U,
+    0xB23D0208U, 0xA7190209U, 0xE213020AU, 0x8C37020BU, 0xEA14020CU, 0x9309020DU, 0xCA8C020EU, 0x9093020FU,
+    0xFC970210U, 0xE53E0211U, 0xDAB50212U, 0xE2810213U, 0xDE150214U, 0xFE630215U, 0xF7980216U, 0xD67B0217U,
+    0xE5310218U, 0xD3730219U, 0xA9B7021AU, 0x9A88021BU, 0xFBD6021CU, 0xD975021DU, 0xB988021EU, 0x88CF021FU,
+    0xC57E0220U, 0xC7870221U, 0xA0D00222U, 0xCA280223U, 0xB67E0224U, 0xA7580225U, 0xAC210226U, 0xCE4A0227U,
+    0xC1C60228U, 0x90160229U, 0xE4FA022AU, 0x8B3C022BU, 0xB7EE022CU, 0xB663022DU, 0xCE44022EU, 0xC38C022FU,
+    0xB0640230U, 0xE3A20231U, 0xD58C0232U, 0x8A310233U, 0x88860234U, 0xC7F40235U, 0xB1C70236U, 0xB1F10237U,
+    0xAB010238U, 0xCA110239U, 0x810F023AU, 0x9A97023BU, 0xBFD5023CU, 0xBF6E023DU, 0xFDD8023EU, 0xE6E0023FU,
+    0x91B60240U, 0x94850241U, 0xADE20242U, 0x928E0243U, 0xDD810244U, 0xEC030245U, 0x89290246U, 0x9F3A0247U,
+    0xD2CC0248U, 0x891E0249U, 0x814C024AU, 0xFC41024BU, 0xBB7A024CU, 0xBD98024DU, 0xDC1C024EU, 0xDF07024FU,
+    0xA71E0250U, 0x9ABA0251U, 0xAD4D0252U, 0xCB180253U, 0x9BF70254U, 0xA9560255U, 0x9EE40256U, 0x90990257U,
+    0x8DD70258U, 0xF82F0259U, 0xDE95025AU, 0xFEC8025BU, 0xAB70025CU, 0xB5A2025DU, 0xEA4A025EU, 0x94E1025FU,
+    0xF3A90260U, 0x97C90261U, 0x874C0262U, 0x8F160263U, 0xE7C10264U, 0xF2330265U, 0xD3890266U, 0x8BFC0267U,
+    0x95E40268U, 0xFF430269U, 0xEC92026AU, 0xB0B2026BU, 0x95BF026CU, 0x8EF9026DU, 0x9162026EU, 0x9664026FU,
+    0xDEC90270U, 0xCB360271U, 0xC5660272U, 0xBB070273U, 0xCDCE0274U, 0x84E60275U, 0xE5D00276U, 0x9E790277U,
+    0xB6040278U, 0xA9670279U, 0xEF5F027AU, 0xAF80027BU, 0x9A92027CU, 0x8AFB027DU, 0xFBAF027EU, 0xDD3C027FU,
+    0xD8550280U, 0xC2300281U, 0xC86C0282U, 0xBDB00283U, 0x98560284U, 0xD9F40285U, 0xEB300286U, 0xEF090287U,
+    0xFB7C0288U, 0xCD8B0289U, 0x9355028AU, 0xC47F028BU, 0xC518028CU, 0xC786028DU, 0xA1B4028EU, 0xC405028FU,
+    0x81450290U, 0xE4840291U, 0xB19B0292U, 0xED300293U, 0xDEA10294U, 0xFB3B0295U, 0xDD0C0296U, 0xFC280297U,
+    0xE2500298U, 0xE01F0299U, 0x9A3B029AU, 0xC808029BU, 0x99FB029CU, 0xAB06029DU, 0xF656029EU, 0xA766029FU,
+    0xC13B02A0U, 0xEB1A02A1U, 0xBE8102A2U, 0xB5F002A3U, 0xA79702A4U, 0xA56F02A5U, 0x973A02A6U, 0xB78D02A7U,
+    0xF30B02A8U, 0xBE6302A9U, 0x9BC802AAU, 0xFE8502ABU, 0xA39002ACU, 0xD27E02ADU, 0x840A02AEU, 0xB99902AFU,
+    0xA31202B0U, 0xA50302B1U, 0xEA0D02B2U, 0xF38602B3U, 0x862C02B4U, 0xBE8702B5U, 0xA32B02B6U, 0xA91402B7U,
+    0xDA3802B8U, 0xCF2802B9U, 0xB2B902BAU, 0xCABC02BBU, 0xCBF402BCU, 0x8D5902BDU, 0x960E02BEU, 0x8B7D02BFU,
+    0xC6F302C0U, 0xD3B302C1U, 0xB61302C2U, 0xE33902C3U, 0xF7FC02C4U, 0x8EFB02C5U, 0xAF9D02C6U, 0xED3702C7U,
+    0xD2CD02C8U, 0xDC1D02C9U, 0xAEFA02CAU, 0xDB3D02CBU, 0xF62E02CCU, 0xFD8002CDU, 0xA19F02CEU, 0xD55802CFU,
+    0xA8E602D0U, 0xB7D202D1U, 0xB6C302D2U, 0xB55B02D3U, 0xD55C02D4U, 0xF94B02D5U, 0xD8F202D6U, 0xDD9E02D7U,
+    0xED7302D8U, 0xE92402D9U, 0xE55502DAU, 0x85F302DBU, 0xFF9F02DCU, 0x993202DDU, 0xEFD402DEU, 0x881902DFU,
+    0xE53402E0U, 0x889202E1U, 0xDF4C02E2U, 0xE37B02E3U, 0xD04602E4U, 0x990002E5U, 0xF35602E6U, 0xE5DB02E7U,
+    0x998002E8U, 0x8C0102E9U, 0xC46002EAU, 0xE88802EBU, 0xFC6502ECU, 0xF90F02EDU, 0xB82D02EEU, 0xB3D602EFU,
+    0xF53502F0U, 0xE12802F1U, 0xF6B602F2U, 0xD4B402F3U, 0x9B0D02F4U, 0xE8DF02F5U, 0xB88D02F6U, 0x9E1902F7U,
+    0xBA7A02F8U, 0xEDDF02F9U, 0xD1B702FAU, 0x955E02FBU, 0xC66802FCU, 0xE22802FDU, 0xC0B102FEU, 0xB6BC02FFU,
+    0xCE580300U, 0xE2CD0301U, 0xA4290302U, 0xE9CD0303U, 0xAF210304U, 0xF47F0305U, 0xF9360306U, 0xC2720307U,
+    0xC47F0308U, 0xE11F0309U, 0xCC9B030AU, 0xE93C030BU, 0xC8C1030CU, 0xE681030DU, 0xAE47030EU, 0xCF71030FU,
+    0xA42C0310U, 0xE1030311U, 0x92610312U, 0xFF330313U, 0xE7B90314U, 0x941C0315U, 0xD6370316U, 0xC4FF0317U,
+    0xF4390318U, 0xE2630319U, 0xF3E1031AU, 0xE053031BU, 0x9259031CU, 0xA448031DU, 0xD991031EU, 0xC62F031FU,
+    0xFCBB0320U, 0xAF990321U, 0xDA070322U, 0x890E0323U, 0xA22C0324U, 0xE6010325U, 0xD3670326U, 0xAA0C0327U,
+    0xCD900328U, 0x92880329U, 0xDD6C032AU, 0xCA87032BU, 0xFD7D032CU, 0xA01A032DU, 0xB3CD032EU, 0xF74C032FU,
+    0xC7350330U, 0x929E0331U, 0x8BB90332U, 0xACDF0333U, 0xCEEA0334U, 0xAA750335U, 0x80960336U, 0xD0BD0337U,
+    0xAE8A0338U, 0xBEBA0339U, 0xFE3E033AU, 0xFFCD033BU, 0xC5A3033CU, 0xC68C033DU, 0x9791033EU, 0xCA7D033FU,
+    0xBB9F0340U, 0x97770341U, 0x9F1B0342U, 0x818E0343U, 0xD2BD0344U, 0x87930345U, 0xA9AB0346U, 0xB9AF0347U,
+    0x90220348U, 0x95FA0349U, 0x9610034AU, 0xFF9F034BU, 0xFAB6034CU, 0x90FB034DU, 0xFD86034EU, 0x912F034FU,
+    0x862E0350U, 0xA7CA0351U, 0xAA0A0352U, 0xC05F0353U, 0xBBF70354U, 0xC0EB0355U, 0xB8800356U, 0x85740357U,
+    0xC8580358U, 0x8D620359U, 0xCDCB035AU, 0xE163035BU, 0x9227035CU, 0xCAC6035DU, 0xF36D035EU, 0xCC8C035FU,
+    0xB04B0360U, 0xAE790361U, 0xD2990362U, 0xCBDF0363U, 0xD6760364U, 0xA46C0365U, 0x81570366U, 0x8AFC0367U,
+    0xCB8F0368U, 0xB3180369U, 0xA557036AU, 0xDA52036BU, 0xD8EF036CU, 0x92F3036DU, 0xF1C7036EU, 0x91AD036FU,
+    0x83730370U, 0xD33F0371U, 0x8A1F0372U, 0xCA660373U, 0xE7BE0374U, 0xC1CA0375U, 0x90630376U, 0xDDB90377U,
+    0xDDF50378U, 0xE8380379U, 0xCBAA037AU, 0x81B8037BU, 0xEBA1037CU, 0x8A3B037DU, 0xBFC8037EU, 0xB9C4037FU,
+    0xAE040380U, 0xCD7B0381U, 0xF0FD0382U, 0xEEA60383U, 0xC3EC0384U, 0xE7F30385U, 0xDEEB0386U, 0x85430387U,
+    0xD15E0388U, 0xD0250389U, 0xCA1D038AU, 0xD32E038BU, 0xFD06038CU, 0xDA4D038DU, 0x9A5E038EU, 0xBEDE038FU,
+    0xB1EF0390U, 0xD8B60391U, 0x8E550392U, 0xF6A30393U, 0xA44F0394U, 0xF7560395U, 0x87A00396U, 0xCF6D0397U,
+    0x80460398U, 0xA4AF0399U, 0xD338039AU, 0x9066039BU, 0x844E039CU, 0x826B039DU, 0xE915039EU, 0xF0BA039FU,
+    0x93CE03A0U, 0xFA0903A1U, 0xCC1903A2U, 0xD3E403A3U, 0x9A6003A4U, 0x885F03A5U, 0x904603A6U, 0xC33103A7U,
+    0x991103A8U, 0xB9A003A9U, 0xF77303AAU, 0xCE7B03ABU, 0xC88103ACU, 0xA65F03ADU, 0x92B903AEU, 0xEB2F03AFU,
+    0xA2E703B0U, 0x98AE03B1U, 0x899003B2U, 0xA5F503B3U, 0xD80B03B4U, 0x9D1203B5U, 0x830603B6U, 0xB07803B7U,
+    0xD97603B8U, 0x94FF03B9U, 0x922E03BAU, 0xC5C503BBU, 0x85B303BCU, 0xC0F103BDU, 0xA24603BEU, 0x91AD03BFU,
+    0x890303C0U, 0x998003C1U, 0xA14C03C2U, 0x900C03C3U, 0x94B603C4U, 0x81A403C5U, 0xF53003C6U, 0xE42303C7U,
+    0xD13103C8U, 0xD65203C9U, 0x9F8B03CAU, 0xD72803CBU, 0x93AA03CCU, 0xA11B03CDU, 0xB4C303CEU, 0xAF2803CFU,
+    0xBB5903D0U, 0xAD8403D1U, 0xA47A03D2U, 0x8E9103D3U, 0xCA1903D4U, 0x832A03D5U, 0xEFEF03D6U, 0xB26203D7U,
+    0xDC5F03D8U, 0xF9BB03D9U, 0xE79003DAU, 0xD9BC03DBU, 0xCFCD03DCU, 0xA53403DDU, 0xF09C03DEU, 0xB75303DFU,
+    0xAA9403E0U, 0xEEEF03E1U, 0xB94F03E2U, 0xBEB503E3U, 0xBEF803E4U, 0xA8BE03E5U, 0xB51003E6U, 0x95AC03E7U,
+    0xDD2703E8U, 0xF44D03E9U, 0x9B5D03EAU, 0x933E03EBU, 0xC23903ECU, 0xCB5503EDU, 0xE4B003EEU, 0x9BC503EFU,
+    0x9C0C03F0U, 0x988A03F1U, 0xE9B403F2U, 0xB55503F3U, 0xD33403F4U, 0xCAF703F5U, 0x93AD03F6U, 0x84CD03F7U,
+    0xFB8103F8U, 0xC89203F9U, 0xA79703FAU, 0xC87703FBU, 0xE1C803FCU, 0xFF5D03FDU, 0xC4AA03FEU, 0xB18303FFU,
+    0xECCD0400U, 0xEB6B0401U, 0xFF570402U, 0xDDA10403U, 0xF3A20404U, 0xC1150405U, 0xD2120406U, 0xDE5C0407U,
+    0xF65B0408U, 0xFF2E0409U, 0x83D3040AU, 0xCB9D040BU, 0xA050040CU, 0x8C64040DU, 0xCDC2040EU, 0xB050040FU,
+    0xD6170410U, 0xA4FC0411U, 0xF8440412U, 0x9A1B0413U, 0x8F470414U, 0xFFB80415U, 0xD62A0416U, 0xCBC00417U,
+    0x8FB00418U, 0xB7C70419U, 0xEAF7041AU, 0xEE6A041BU, 0xB090041CU, 0xB2B5041DU, 0xB138041EU, 0x8755041FU,
+    0xD90E0420U, 0xC7110421U, 0xB0870422U, 0xE0010423U, 0x9A540424U, 0xF8FA0425U, 0x847A0426U, 0xFF760427U,
+    0xCFC20428U, 0xE15E0429U, 0xA297042AU, 0x8B35042BU, 0x81BF042CU, 0x9C06042DU, 0x8EB8042EU, 0xB669042FU,
+    0xED050430U, 0xE0530431U, 0xE4250432U, 0x8C670433U, 0x934B0434U, 0xE1F90435U, 0xB2A20436U, 0xAA670437U,
+    0x9D3B0438U, 0xF13B0439U, 0x8038043AU, 0xDFD6043BU, 0xE407043CU, 0xAB40043DU, 0xF775043EU, 0xCE1B043FU,
+    0x8E690440U, 0xCDDF0441U, 0xBA160442U, 0xFC790443U, 0xE2260444U, 0x8F110445U, 0xB5F00446U, 0xCC5D0447U,
+    0xA49A0448U, 0xCB2C0449U, 0x8D5E044AU, 0xEE46044BU, 0xB48D044CU, 0xFFC3044DU, 0xFCEB044EU, 0xD38A044FU,
+    0x9AC00450U, 0x9B210451U, 0x918A0452U, 0x90CA0453U, 0xA41C0454U, 0xF39B0455U, 0xB0D90456U, 0xDED70457U,
+    0xF4070458U, 0x89920459U, 0x9A81045AU, 0xB9BF045BU, 0xD501045CU, 0xFB2E045DU, 0xFB69045EU, 0x9C1C045FU,
+    0xFEED0460U, 0xB5BF0461U, 0xEC9B0462U, 0xD5AD0463U, 0xBD2F0464U, 0xD0A20465U, 0xA36F0466U, 0xA24B0467U,
+    0xBD4B0468U, 0x88C30469U, 0xABAE046AU, 0x9AB0046BU, 0xDECB046CU, 0x8525046DU, 0x9F79046EU, 0xB32F046FU,
+    0xFD050470U, 0xBE310471U, 0xFD8E0472U, 0xBB2C0473U, 0xA46C0474U, 0xE65D0475U, 0x884C0476U, 0x95F90477U,
+    0xDD400478U, 0xF0440479U, 0xDF66047AU, 0x9646047BU, 0xC86B047CU, 0xB372047DU, 0xD75C047EU, 0xC181047FU,
+    0xCA330480U, 0xDF180481U, 0xD8CC0482U, 0xDFC50483U, 0x93A80484U, 0xC1280485U, 0x95100486U, 0xBBB00487U,
+    0xED470488U, 0x99C70489U, 0xB8C1048AU, 0xEFCE048BU, 0x9210048CU, 0xBC29048DU, 0xDFF0048EU, 0x82D8048FU,
+    0xBEFF0490U, 0xA1940491U, 0xE0220492U, 0x91A50493U, 0xDB030494U, 0x8F1A0495U, 0xBD8F0496U, 0xA6220497U,
+    0xC2BC0498U, 0xE07D0499U, 0xDDC5049AU, 0x866F049BU, 0xD014049CU, 0x87BE049DU, 0x917C049EU, 0xF0CA049FU,
+    0xBA6604A0U, 0xED9904A1U, 0xC71804A2U, 0xCE4B04A3U, 0xCDDC04A4U, 0xB41D04A5U, 0xAFF804A6U, 0xA4AD04A7U,
+    0xAF8404A8U, 0x961D04A9U, 0xD60404AAU, 0xFF8104ABU, 0xA67804ACU, 0xE8DF04ADU, 0x9A1F04AEU, 0xE98D04AFU,
+    0xFF6C04B0U, 0xDCFF04B1U, 0x8FB304B2U, 0xF40604B3U, 0xC8C304B4U, 0xD6B904B5U, 0xCD3804B6U, 0x95DE04B7U,
+    0xAEB204B8U, 0xDA6904B9U, 0xCF1B04BAU, 0x93A204BBU, 0xAD9B04BCU, 0xE42104BDU, 0xC6EA04BEU, 0x890C04BFU,
+    0xB3B104C0U, 0xB0C104C1U, 0xF09904C2U, 0xCC0904C3U, 0xB84004C4U, 0xE2DD04C5U, 0x970504C6U, 0x9E2A04C7U,
+    0x98C404C8U, 0xFA7C04C9U, 0xEA2404CAU, 0xBFF204CBU, 0xF21B04CCU, 0x81D604CDU, 0xB14104CEU, 0x9DD504CFU,
+    0xE24604D0U, 0xDD1A04D1U, 0xE2F604D2U, 0xF3F704D3U, 0xE1CC04D4U, 0xA30104D5U, 0xA6F804D6U, 0xA15A04D7U,
+    0x8FD304D8U, 0xF9E704D9U, 0xA21904DAU, 0x9D8004DBU, 0xC91604DCU, 0x8B1F04DDU, 0xBEBD04DEU, 0xD7B504DFU,
+    0xC77F04E0U, 0xD10E04E1U, 0xCF0904E2U, 0x983304E3U, 0xF1D004E4U, 0xB4F604E5U, 0xD4FF04E6U, 0x80CA04E7U,
+    0x9F5204E8U, 0xF78704E9U, 0xA0DA04EAU, 0xF93E04EBU, 0xA71204ECU, 0xB30A04EDU, 0x84A404EEU, 0x9FCD04EFU,
+    0xA92804F0U, 0xE2ED04F1U, 0xB57004F2U, 0xF41D04F3U, 0xEEAC04F4U, 0xC19304F5U, 0xF37104F6U, 0x938D04F7U,
+    0xEB8604F8U, 0xAB9B04F9U, 0xA84604FAU, 0xD0C404FBU, 0x88D204FCU, 0xDD5C04FDU, 0xCEE004FEU, 0xD43504FFU,
+    0x88860500U, 0x8D9C0501U, 0xBD770502U, 0xAD220503U, 0xB9500504U, 0xE5360505U, 0xF5380506U, 0xA7400507U,
+    0x81830508U, 0xBB470509U, 0xE010050AU, 0xFF90050BU, 0xC384050CU, 0xCB8A050DU, 0xF3BC050EU, 0xB114050FU,
+    0xBBDB0510U, 0xCB080511U, 0x8AB70512U, 0xD8130513U, 0xC1200514U, 0xD0D70515U, 0xF0400516U, 0xFF140517U,
+    0x85960518U, 0x96370519U, 0x9581051AU, 0xD5F3051BU, 0xF529051CU, 0x9760051DU, 0xA5C7051EU, 0xD248051FU,
+    0x92400520U, 0xCDC20521U, 0xB8570522U, 0x8E9B0523U, 0xB8730524U, 0xD1760525U, 0xD8EE0526U, 0xEFAA0527U,
+    0x8A190528U, 0xCC390529U, 0xBD36052AU, 0xCF53052BU, 0xA22B052CU, 0xE531052DU, 0xAD77052EU, 0x918B052FU,
+    0xCE280530U, 0x8D200531U, 0xF0600532U, 0xCE4D0533U, 0xE00E0534U, 0xC2460535U, 0xC11D0536U, 0xD5670537U,
+    0xB8EE0538U, 0x85BE0539U, 0xF694053AU, 0x85F8053BU, 0xE733053CU, 0xDBA9053DU, 0xAC41053EU, 0xD9B4053FU,
+    0xED590540U, 0xA1D00541U, 0x90E90542U, 0xF5FE0543U, 0x89CB0544U, 0xCEDB0545U, 0xC0A20546U, 0xB7F10547U,
+    0xF5E70548U, 0xE0830549U, 0xA759054AU, 0xED03054BU, 0xB070054CU, 0xFDFB054DU, 0xEC0C054EU, 0xFEC9054FU,
+    0x85650550U, 0x96FF0551U, 0xCA0F0552U, 0xBDAC0553U, 0x8E3A0554U, 0xD6B60555U, 0xAB1D0556U, 0xE5160557U,
+    0xEB880558U, 0x9E740559U, 0xD3F9055AU, 0xDE4F055BU, 0x83EF055CU, 0xE5C3055DU, 0xD7A9055EU, 0x948E055FU,
+    0xD8540560U, 0xD4810561U, 0xA1930562U, 0x9EE00563U, 0x828E0564U, 0x820A0565U, 0xF6FC0566U, 0x8B550567U,
+    0xD5A60568U, 0xA21D0569U, 0xD7DB056AU, 0x830F056BU, 0xE300056CU, 0xE457056DU, 0xED08056EU, 0xEC35056FU,
+    0x8EB50570U, 0xFFE40571U, 0xC7570572U, 0xB7080573U, 0x864F0574U, 0xEEB80575U, 0xA4F70576U, 0xA8D10577U,
+    0xF0D70578U, 0x898F0579U, 0xC0AC057AU, 0xA4A3057BU, 0xDB8A057CU, 0xEABD057DU, 0xE10E057EU, 0x9101057FU,
+    0xEBB30580U, 0xBD410581U, 0xE4300582U, 0xC3750583U, 0xB9F60584U, 0xA82C0585U, 0xD57B0586U, 0xDC680587U,
+    0xF17D0588U, 0xB4B80589U, 0xB949058AU, 0xA5E7058BU, 0xFAB9058CU, 0x846A058DU, 0xDE82058EU, 0xD771058FU,
+    0xC6050590U, 0xB3BD0591U, 0xE75E0592U, 0x88290593U, 0xA5800594U, 0x91C70595U, 0xBBB50596U, 0xD0C20597U,
+    0xAC100598U, 0xB66E0599U, 0xDD7F059AU, 0xF74E059BU, 0xAF2B059CU, 0xE2B3059DU, 0xC718059EU, 0xE736059FU,
+    0xE49205A0U, 0xFD9E05A1U, 0xF74905A2U, 0x808A05A3U, 0xD50505A4U, 0xA40005A5U, 0xDA4905A6U, 0x9E1C05A7U,
+    0x840D05A8U, 0xBB1705A9U, 0xCA8B05AAU, 0xAC0A05ABU, 0xEA3B05ACU, 0xA06405ADU, 0xA3B805AEU, 0xC31305AFU,
+    0xDF0E05B0U, 0x97AB05B1U, 0x8C5F05B2U, 0xBC7805B3U, 0xF7D005B4U, 0xFFE105B5U, 0x890E05B6U, 0xD86505B7U,
+    0xFCF305B8U, 0x998905B9U, 0xB0B805BAU, 0xC21505BBU, 0xF01005BCU, 0x825505BDU, 0x825D05BEU, 0xAF2E05BFU,
+    0xCF9605C0U, 0xCBA205C1U, 0xCDA505C2U, 0xB8F505C3U, 0xE39E05C4U, 0xB50405C5U, 0xC26D05C6U, 0xD59A05C7U,
+    0x9C6A05C8U, 0x9C8605C9U, 0x81D405CAU, 0xBA7D05CBU, 0xDA7305CCU, 0xABCF05CDU, 0xBC4C05CEU, 0x846405CFU,
+    0xBE9D05D0U, 0xEC0205D1U, 0xC60C05D2U, 0xC02D05D3U, 0xB41E05D4U, 0xA9E205D5U, 0x8ED505D6U, 0xA5FB05D7U,
+    0xDAE705D8U, 0xA85505D9U, 0xD23505DAU, 0x9FBF05DBU, 0xFBE705DCU, 0xB3E805DDU, 0xD7E105DEU, 0xD69F05DFU,
+    0xBE1005E0U, 0xDA9305E1U, 0xD8F805E2U, 0x89B905E3U, 0xB3E205E4U, 0xA0CF05E5U, 0x928D05E6U, 0xDC9305E7U,
+    0x983F05E8U, 0xE89405E9U, 0xD9FF05EAU, 0xC2C305EBU, 0x954105ECU, 0xBCF905EDU, 0xC41A05EEU, 0x8F2F05EFU,
+    0xD0E905F0U, 0xD51C05F1U, 0xD09E05F2U, 0xEC9205F3U, 0xFC0B05F4U, 0xFF3D05F5U, 0xF07F05F6U, 0xA15305F7U,
+    0x8ECF05F8U, 0x931805F9U, 0x91FE05FAU, 0xE55605FBU, 0xC12A05FCU, 0xB22205FDU, 0x802E05FEU, 0xAC9B05FFU,
+    0x81E70600U, 0x923A0601U, 0xA2AA0602U, 0xBB280603U, 0x95450604U, 0xBECE0605U, 0xF5DD0606U, 0xD4050607U,
+    0xD4450608U, 0xD9490609U, 0xC522060AU, 0xDDAE060BU, 0x96A6060CU, 0x9332060DU, 0xECAD060EU, 0xA85C060FU,
+    0x97CB0610U, 0xC0DA0611U, 0x9F7E0612U, 0xDA3F0613U, 0xBCFE0614U, 0xA02A0615U, 0xF80F0616U, 0xC39C0617U,
+    0xD51F0618U, 0x88FF0619U, 0xC864061AU, 0xE8C9061BU, 0xE7EF061CU, 0xBD48061DU, 0x9FAD061EU, 0x8786061FU,
+    0x9C460620U, 0xB2AF0621U, 0xD53D0622U, 0xE4590623U, 0xDCDE0624U, 0x98390625U, 0xF8170626U, 0xE85B0627U,
+    0xEFA90628U, 0xEC290629U, 0x8150062AU, 0x9CBB062BU, 0xE91A062CU, 0x96A2062DU, 0xFC25062EU, 0xD696062FU,
+    0xE7F10630U, 0xC6E30631U, 0xEE470632U, 0x94950633U, 0xBD850634U, 0xD7920635U, 0xDD130636U, 0xFC500637U,
+    0x9F100638U, 0xD1D50639U, 0xCBF8063AU, 0xA466063BU, 0xD0C8063CU, 0xBEFF063DU, 0xCA2A063EU, 0xECC4063FU,
+    0xC3550640U, 0xE3A20641U, 0xB61F0642U, 0x97490643U, 0xEA0E0644U, 0x8A3C0645U, 0xC1D30646U, 0xD4710647U,
+    0xB7610648U, 0xF6DD0649U, 0xC600064AU, 0xA505064BU, 0xBE18064CU, 0xEBB7064DU, 0xC471064EU, 0x8513064FU,
+    0xA2880650U, 0xE3C00651U, 0x97DF0652U, 0x87330653U, 0xEB6A0654U, 0xA4010655U, 0x8C150656U, 0xD06A0657U,
+    0x87750658U, 0x91460659U, 0xBF38065AU, 0xA13B065BU, 0xBAEC065CU, 0xD325065DU, 0x84D1065EU, 0xAE9D065FU,
+    0xC81B0660U, 0xECCF0661U, 0xABF80662U, 0x9E150663U, 0x9B910664U, 0x84990665U, 0xA0910666U, 0xBFAA0667U,
+    0x9E410668U, 0xD3260669U, 0xF113066AU, 0x80E6066BU, 0xBBE0066CU, 0xDA86066DU, 0x9897066EU, 0xF966066FU,
+    0x9F2B0670U, 0xB8A70671U, 0xC2380672U, 0xD1870673U, 0xCDA30674U, 0xA62F0675U, 0xE8350676U, 0xE2F20677U,
+    0xB4D40678U, 0xC7B40679U, 0x827E067AU, 0xCF48067BU, 0xF4E8067CU, 0x83DA067DU, 0xF8BE067EU, 0xA9CB067FU,
+    0xC8A00680U, 0xB8A00681U, 0xE0770682U, 0xF1E50683U, 0xB0700684U, 0xFEFA0685U, 0xE6DD0686U, 0xDF980687U,
+    0x92A20688U, 0xF4FB0689U, 0xA515068AU, 0x9257068BU, 0xDA9E068CU, 0xB62D068DU, 0xEB44068EU, 0x9554068FU,
+    0xFAA30690U, 0xF3B40691U, 0xCACB0692U, 0xC9CC0693U, 0xF30F0694U, 0xCB040695U, 0xC3EC0696U, 0xC6BE0697U,
+    0x88DD0698U, 0xFAE70699U, 0xC830069AU, 0x87C2069BU, 0xFD8A069CU, 0xA3DD069DU, 0xA406069EU, 0xDD9C069FU,
+    0xB59406A0U, 0xFB6806A1U, 0xC85A06A2U, 0xAB8206A3U, 0xD62306A4U, 0xAA4B06A5U, 0x990906A6U, 0xAAE306A7U,
+    0xA4A706A8U, 0xA7CD06A9U, 0xD7D206AAU, 0x96D506ABU, 0xF29A06ACU, 0xCA7906ADU, 0xA9D606AEU, 0xBB9B06AFU,
+    0xAC3E06B0U, 0xF0BF06B1U, 0xB24F06B2U, 0xA34D06B3U, 0x956506B4U, 0x842206B5U, 0xBBD006B6U, 0x8E2B06B7U,
+    0xE84B06B8U, 0xA25406B9U, 0xDE8506BAU, 0xD9CC06BBU, 0xC93406BCU, 0x9CFD06BDU, 0xB8D206BEU, 0xE5F906BFU,
+    0xFF3706C0U, 0xA19306C1U, 0xB60306C2U, 0xEA9A06C3U, 0x8D9206C4U, 0xBAF706C5U, 0xB4AB06C6U, 0xE3C606C7U,
+    0xA29906C8U, 0xB58D06C9U, 0x8EA506CAU, 0x884506CBU, 0xEBBF06CCU, 0xE3B606CDU, 0x9DC006CEU, 0x964206CFU,
+    0xBF1006D0U, 0xE30106D1U, 0xAA4E06D2U, 0xE3F206D3U, 0xABCB06D4U, 0x90D506D5U, 0xA27A06D6U, 0xFA5A06D7U,
+    0xD95506D8U, 0x959E06D9U, 0xF9D806DAU, 0xB6BB06DBU, 0xE2D006DCU, 0xB46C06DDU, 0x8E2306DEU, 0x80C106DFU,
+    0x851A06E0U, 0xAE1106E1U, 0xF83A06E2U, 0xAE8606E3U, 0xC55406E4U, 0xE23606E5U, 0xB38C06E6U, 0xBDC906E7U,
+    0xA35306E8U, 0xA1E706E9U, 0xD70C06EAU, 0xA81306EBU, 0xD13606ECU, 0xEF3906EDU, 0xE01606EEU, 0x88DA06EFU,
+    0xA0E906F0U, 0x953B06F1U, 0xE06506F2U, 0xBC9906F3U, 0x90E606F4U, 0xAEC806F5U, 0xEA4B06F6U, 0x9E4C06F7U,
+    0x86A306F8U, 0xDF7606F9U, 0xB1AE06FAU, 0xA6BD06FBU, 0xC2BD06FCU, 0x898306FDU, 0xD8A906FEU, 0xBE7E06FFU,
+    0xA26A0700U, 0xC55B0701U, 0xCC4E0702U, 0xB0CA0703U, 0xE4C20704U, 0xE1730705U, 0xFD1F0706U, 0xE9090707U,
+    0xF7BA0708U, 0xD86D0709U, 0xB7BF070AU, 0xFA5C070BU, 0xB8BB070CU, 0xC940070DU, 0xE6EB070EU, 0xA327070FU,
+    0xCB350710U, 0xF3B50711U, 0x85B60712U, 0xF9390713U, 0x92370714U, 0xCD9E0715U, 0xBFF70716U, 0xE3920717U,
+    0xE4840718U, 0xE4070719U, 0xD0B8071AU, 0xAC07071BU, 0x84F1071CU, 0xC152071DU, 0xE01F071EU, 0xAA52071FU,
+    0xE0650720U, 0xCA000721U, 0xC81B0722U, 0x9CBC0723U, 0xB5210724U, 0x8D440725U, 0xF5C30726U, 0xD5620727U,
+    0x8DE70728U, 0xDCBB0729U, 0xBF8C072AU, 0xF48A072BU, 0x8AAD072CU, 0x8B26072DU, 0xD6C7072EU, 0xC6F4072FU,
+    0xD89E0730U, 0xFD4D0731U, 0xF9420732U, 0xB92A0733U, 0xC5440734U, 0xAB790735U, 0xFCE80736U, 0xE84D0737U,
+    0xDDFE0738U, 0xC6A90739U, 0xE5AF073AU, 0x9534073BU, 0xD5AD073CU, 0xC190073DU, 0x980C073EU, 0xB85A073FU,
+    0xBBD20740U, 0x8D2F0741U, 0xFBCB0742U, 0x9FB20743U, 0xEA8E0744U, 0xEB520745U, 0xC4480746U, 0xEC130747U,
+    0xADF90748U, 0x95130749U, 0x8567074AU, 0xC911074BU, 0x9EF4074CU, 0xB2FA074DU, 0xC866074EU, 0x8821074FU,
+    0xA2520750U, 0x908F0751U, 0xD11B0752U, 0x8C1B0753U, 0xE04D0754U, 0xA71B0755U, 0xA30C0756U, 0x8A450757U,
+    0xAA3B0758U, 0xB0660759U, 0x8057075AU, 0xA7E2075BU, 0xAFCD075CU, 0xCF5F075DU, 0xEEA4075EU, 0xA742075FU,
+    0xEDE30760U, 0xB9370761U, 0xFACF0762U, 0xC7450763U, 0xC0E60764U, 0x8EF00765U, 0xD36C0766U, 0x875B0767U,
+    0xA47B0768U, 0xA9B30769U, 0xBDD1076AU, 0xC358076BU, 0xF2B3076CU, 0xD8A2076DU, 0xF14E076EU, 0xE6BB076FU,
+    0xC6B40770U, 0xA57B0771U, 0x8BC30772U, 0xF99F0773U, 0xEC760774U, 0xB6CB0775U, 0xAF2B0776U, 0x92210777U,
+    0x8DFB0778U, 0xE7FB0779U, 0xADCE077AU, 0xAF1F077BU, 0x9F0A077CU, 0xC950077DU, 0xCDB5077EU, 0xF2E5077FU,
+    0xD9790780U, 0x950F0781U, 0xEE270782U, 0xF0060783U, 0x9FF60784U, 0x8A380785U, 0xBE830786U, 0xCBDF0787U,
+    0xFBB20788U, 0xBAB90789U, 0xBF00078AU, 0xF5E2078BU, 0x815B078CU, 0xEC8C078DU, 0xB4FE078EU, 0xD69C078FU,
+    0xFFD10790U, 0xCC3B0791U, 0xB07D0792U, 0xB2360793U, 0xA9BE0794U, 0xDF590795U, 0xA52A0796U, 0xA73A0797U,
+    0x9FF20798U, 0xDB340799U, 0xCC0A079AU, 0x9A87079BU, 0xE017079CU, 0x9192079DU, 0xFFB6079EU, 0xAF82079FU,
+    0x83F107A0U, 0xA34807A1U, 0xD3B807A2U, 0xE42007A3U, 0xDC6C07A4U, 0xC7D907A5U, 0xEF6F07A6U, 0xA99A07A7U,
+    0x954D07A8U, 0xB97807A9U, 0xFB9C07AAU, 0x8D5007ABU, 0xA02F07ACU, 0x83CC07ADU, 0xC1C407AEU, 0xC74C07AFU,
+    0xFBCA07B0U, 0xBC5507B1U, 0xE9B107B2U, 0xB48107B3U, 0x870307B4U, 0xBAD407B5U, 0x9F3D07B6U, 0x9C6807B7U,
+    0xAD1F07B8U, 0xABA807B9U, 0x8A7707BAU, 0xAF9E07BBU, 0xB57A07BCU, 0xE55607BDU, 0xCD5907BEU, 0x87F207BFU,
+    0xA92007C0U, 0xAEDD07C1U, 0xE0F607C2U, 0xC39F07C3U, 0xA65207C4U, 0xFD6807C5U, 0xCEEE07C6U, 0xC49707C7U,
+    0xCE6D07C8U, 0x811F07C9U, 0x9ABA07CAU, 0x99AB07CBU, 0xDC7607CCU, 0xF14D07CDU, 0xE4D407CEU, 0xF1C007CFU,
+    0xA7CF07D0U, 0xD37607D1U, 0xEB8707D2U, 0xEEE907D3U, 0xEB0A07D4U, 0x8F0F07D5U, 0xDBEA07D6U, 0xD1FE07D7U,
+    0xECAE07D8U, 0xF86E07D9U, 0xF53E07DAU, 0xE82F07DBU, 0x863D07DCU, 0x831C07DDU, 0xDC8D07DEU, 0xDF1907DFU,
+    0xA12707E0U, 0xDAB007E1U, 0xBE8F07E2U, 0xAEDD07E3U, 0xE2D007E4U, 0x9BDB07E5U, 0xF29A07E6U, 0xB4FD07E7U,
+    0xC72107E8U, 0x9D1A07E9U, 0xAA9007EAU, 0xE59D07EBU, 0xC48807ECU, 0xF84207EDU, 0xBA5E07EEU, 0xD51C07EFU,
+    0xD7C507F0U, 0xCE4207F1U, 0xF0BE07F2U, 0xBE0A07F3U, 0xAB1307F4U, 0xC67507F5U, 0xD12807F6U, 0xBA3E07F7U,
+    0xC64807F8U, 0xA9CB07F9U, 0xB70B07FAU, 0xC86807FBU, 0xE19007FCU, 0x932F07FDU, 0xC93907FEU, 0xB56807FFU,
+    0x9A8B0800U, 0x93EB0801U, 0x81E20802U, 0xD59A0803U, 0xE1730804U, 0xDB940805U, 0x87780806U, 0x92770807U,
+    0xD5540808U, 0x89E90809U, 0xADD3080AU, 0xEADF080BU, 0x8209080CU, 0xFFD2080DU, 0xE755080EU, 0xBFDF080FU,
+    0x9A980810U, 0xC4F00811U, 0xBF890812U, 0x94180813U, 0xDFFF0814U, 0xE9650815U, 0x95550816U, 0xF6EB0817U,
+    0xC96E0818U, 0xCDD60819U, 0xC888081AU, 0x88BE081BU, 0xEBDD081CU, 0xC994081DU, 0x938C081EU, 0xD8A8081FU,
+    0xAF040820U, 0xA03F0821U, 0x9FBF0822U, 0xAF180823U, 0xAA4F0824U, 0xA8810825U, 0xE1AF0826U, 0xF0440827U,
+    0xACA00828U, 0xA1830829U, 0x829A082AU, 0x90FF082BU, 0xA6A7082CU, 0xF663082DU, 0xA258082EU, 0xDF99082FU,
+    0x9FEE0830U, 0xE8FE0831U, 0xADDD0832U, 0xCACB0833U, 0xF9920834U, 0xA3420835U, 0xFE340836U, 0xC2690837U,
+    0xC7300838U, 0x9BE10839U, 0xBE24083AU, 0x998F083BU, 0xDC11083CU, 0xEFCE083DU, 0x905A083EU, 0xE4CE083FU,
+    0xF2DE0840U, 0xF1610841U, 0x97330842U, 0xD8C00843U, 0xE9F60844U, 0xD0F70845U, 0x83BB0846U, 0xE38A0847U,
+    0xF6630848U, 0xBD850849U, 0xDF24084AU, 0xFFAB084BU, 0xB57E084CU, 0xA080084DU, 0x9D2E084EU, 0x9E7E084FU,
+    0xEAA90850U, 0xBE0B0851U, 0x82240852U, 0xBB110853U, 0xF0B60854U, 0x91000855U, 0xBFE90856U, 0x912F0857U,
+    0xCC770858U, 0xB21B0859U, 0xA46A085AU, 0xCB81085BU, 0x8284085CU, 0xAC67085DU, 0xFDF0085EU, 0xA42F085FU,
+    0xE6190860U, 0xA69D0861U, 0x98160862U, 0xFE830863U, 0x86660864U, 0xC2890865U, 0xBCC70866U, 0xD7800867U,
+    0xA41B0868U, 0xF14C0869U, 0xFE50086AU, 0xF78B086BU, 0xCB2A086CU, 0xF746086DU, 0x9453086EU, 0x81DE086FU,
+    0xAD630870U, 0x9EA50871U, 0xAE8B0872U, 0x809D0873U, 0xD2800874U, 0xC7900875U, 0x813E0876U, 0xD9200877U,
+    0x914F0878U, 0xD4D80879U, 0x8B1F087AU, 0xCDEF087BU, 0xDB08087CU, 0xB19A087DU, 0xE24E087EU, 0xE39C087FU,
+    0xBB9B0880U, 0xC84A0881U, 0xF1280882U, 0xB66D0883U, 0xE31E0884U, 0xFEB30885U, 0xDF800886U, 0xDC090887U,
+    0xA5D30888U, 0xA4010889U, 0x8498088AU, 0xBDBE088BU, 0x9ADF088CU, 0xDDD1088DU, 0x95C7088EU, 0x8BAB088FU,
+    0xB9300890U, 0xA7300891U, 0xC9EA0892U, 0xA4FE0893U, 0xB4D50894U, 0xC3080895U, 0xA0AA0896U, 0xDDCD0897U,
+    0xF6470898U, 0x9BAA0899U, 0xB18E089AU, 0xE5F1089BU, 0x9CA3089CU, 0xC37E089DU, 0x89F6089EU, 0x9618089FU,
+    0xDAD308A0U, 0x98DE08A1U, 0xAB5408A2U, 0xB62008A3U, 0xF86508A4U, 0xF5D408A5U, 0xC93F08A6U, 0xD3F908A7U,
+    0xD7FF08A8U, 0xBAA508A9U, 0xB16708AAU, 0xACF008ABU, 0xA30B08ACU, 0xD78E08ADU, 0xE7E308AEU, 0x9C8808AFU,
+    0x968B08B0U, 0x9EAB08B1U, 0x932F08B2U, 0xEEBE08B3U, 0xDB1408B4U, 0xDC5E08B5U, 0xDBB808B6U, 0x9E1C08B7U,
+    0xFCFD08B8U, 0xF04B08B9U, 0xCD0608BAU, 0x94C608BBU, 0xC2F108BCU, 0xAF9F08BDU, 0xDB4308BEU, 0xF0E708BFU,
+    0xAE3308C0U, 0xE74208C1U, 0xE15C08C2U, 0xCD9908C3U, 0xA6EA08C4U, 0xE3A408C5U, 0xCEB408C6U, 0xEA0808C7U,
+    0xDF0A08C8U, 0x9BB008C9U, 0x863A08CAU, 0xD78908CBU, 0xDDC908CCU, 0x859408CDU, 0xC96408CEU, 0xA4DE08CFU,
+    0xEDAF08D0U, 0x9AFF08D1U, 0xC6E908D2U, 0xECAA08D3U, 0x8EB708D4U, 0xA4E408D5U, 0x8D1F08D6U, 0xDE0D08D7U,
+    0x9F6E08D8U, 0xBA5B08D9U, 0x802A08DAU, 0xA32308DBU, 0x902408DCU, 0xC0F108DDU, 0xB35408DEU, 0xADCB08DFU,
+    0xDFDB08E0U, 0xCF2A08E1U, 0xF96008E2U, 0xB73408E3U, 0xB01108E4U, 0xAEFB08E5U, 0xA58D08E6U, 0x804F08E7U,
+    0xC9D608E8U, 0xFDE608E9U, 0xC33708EAU, 0xD59E08EBU, 0xF63D08ECU, 0xB84E08EDU, 0x913408EEU, 0xE3D408EFU,
+    0x968908F0U, 0xED6508F1U, 0xD01008F2U, 0x86D108F3U, 0xEE1608F4U, 0xDC6B08F5U, 0xC4F808F6U, 0xF96308F7U,
+    0x9DDF08F8U, 0xFCD608F9U, 0xEE3F08FAU, 0xD9F308FBU, 0xCF2D08FCU, 0xC4EC08FDU, 0xDEC108FEU, 0x995E08FFU,
+    0x96FC0900U, 0xA4580901U, 0xA35B0902U, 0x86020903U, 0xE2BF0904U, 0xD6DB0905U, 0x9C5F0906U, 0x95EA0907U,
+    0x99020908U, 0x93AC0909U, 0xABB4090AU, 0x99D9090BU, 0xEA74090CU, 0xEA3E090DU, 0xC661090EU, 0x84C1090FU,
+    0xD68C0910U, 0xA89D0911U, 0xD24D0912U, 0xBF840913U, 0xFDEC0914U, 0xAF010915U, 0x98D20916U, 0x8E440917U,
+    0xA8DC0918U, 0xF5E80919U, 0x8C5C091AU, 0x9E01091BU, 0xAF15091CU, 0xEF20091DU, 0xFB21091EU, 0xE6E1091FU,
+    0x8AC40920U, 0xF71A0921U, 0xBD420922U, 0xDED50923U, 0xEB2C0924U, 0xA7A40925U, 0xC7F10926U, 0xF9C50927U,
+    0xE3F50928U, 0xFEFB0929U, 0x9F2D092AU, 0xD5A7092BU, 0xC1B5092CU, 0xA5B7092DU, 0xD303092EU, 0xBBA3092FU,
+    0xCC040930U, 0xC8FF0931U, 0xA1C40932U, 0xBDB30933U, 0x9B4D0934U, 0xD7D50935U, 0x8E580936U, 0xF50E0937U,
+    0x89B90938U, 0x862E0939U, 0xA786093AU, 0x8D5B093BU, 0xD077093CU, 0xA363093DU, 0x9063093EU, 0xF967093FU,
+    0xB7DA0940U, 0xA6290941U, 0xC0860942U, 0x8DF70943U, 0xE6C70944U, 0x988F0945U, 0xB8440946U, 0x8B960947U,
+    0xBA270948U, 0xFCE20949U, 0xC212094AU, 0xC5E1094BU, 0xC6AF094CU, 0x9604094DU, 0xDCB8094EU, 0xF7CC094FU,
+    0xF7C50950U, 0xE67F0951U, 0xA1B80952U, 0x85120953U, 0x99DF0954U, 0xC3050955U, 0xD4BB0956U, 0xDB800957U,
+    0xCB0E0958U, 0xEB700959U, 0xF698095AU, 0xCFE1095BU, 0xB23F095CU, 0xFEC8095DU, 0xFFD8095EU, 0xD72C095FU,
+    0x8DAF0960U, 0x83C60961U, 0xF8750962U, 0xC8D40963U, 0x8F610964U, 0xE1320965U, 0xF0A60966U, 0xEF3B0967U,
+    0xE9540968U, 0xB6CA0969U, 0x8CFF096AU, 0xA631096BU, 0xCBB1096CU, 0xCA5C096DU, 0x9931096EU, 0xA12D096FU,
+    0xB6890970U, 0xCCD50971U, 0x80930972U, 0xD2B90973U, 0xF87E0974U, 0x93570975U, 0xF6C10976U, 0xF0A60977U,
+    0xA5F10978U, 0x9DF00979U, 0xEE3D097AU, 0x9F71097BU, 0xDFDB097CU, 0xCD2E097DU, 0xAF63097EU, 0xBA62097FU,
+    0xB7710980U, 0xFF430981U, 0xD4A00982U, 0xB2750983U, 0xF8F30984U, 0xB36F0985U, 0xE47A0986U, 0xE59D0987U,
+    0x89390988U, 0xA5570989U, 0x8905098AU, 0xAE44098BU, 0xB459098CU, 0x9DFF098DU, 0xB1D1098EU, 0xB694098FU,
+    0xD6E70990U, 0xA3470991U, 0xA9F20992U, 0x98E10993U, 0x8DE80994U, 0xB93F0995U, 0x8EB20996U, 0x8E560997U,
+    0x966C0998U, 0xD1B20999U, 0xD65A099AU, 0xB000099BU, 0xF77A099CU, 0xADC1099DU, 0xC770099EU, 0xFE79099FU,
+    0x84F809A0U, 0xB30309A1U, 0xBB7E09A2U, 0xC55F09A3U, 0xD59A09A4U, 0x91B809A5U, 0xDCB309A6U, 0x871A09A7U,
+    0xC2D309A8U, 0xA22B09A9U, 0xD77F09AAU, 0xE84709ABU, 0x833E09ACU, 0xBF3709ADU, 0xC7D209AEU, 0xCE0109AFU,
+    0xB16409B0U, 0xE3C409B1U, 0xB92509B2U, 0xA35209B3U, 0xBACE09B4U, 0xACC509B5U, 0xAFCF09B6U, 0xA02F09B7U,
+    0xF6E609B8U, 0xC39709B9U, 0x946E09BAU, 0xCC3C09BBU, 0xDD0609BCU, 0xB7A609BDU, 0xBE4609BEU, 0x8DAD09BFU,
+    0xD9DF09C0U, 0xC0BD09C1U, 0x8E4309C2U, 0xCE4109C3U, 0x8C4F09C4U, 0xA69109C5U, 0xA39E09C6U, 0xD3CE09C7U,
+    0xFD2409C8U, 0x849609C9U, 0xEC8609CAU, 0x993609CBU, 0x97EA09CCU, 0xC2E509CDU, 0xEFA409CEU, 0xD3A609CFU,
+    0x963A09D0U, 0xCEBE09D1U, 0xE68609D2U, 0x9DBF09D3U, 0xBA7509D4U, 0xF0AC09D5U, 0xED5309D6U, 0x94AA09D7U,
+    0xEA0409D8U, 0xC3B609D9U, 0xD40809DAU, 0xD2EC09DBU, 0xB97509DCU, 0x80E009DDU, 0xD04A09DEU, 0xB66009DFU,
+    0xCF4E09E0U, 0xBF5C09E1U, 0x8D3E09E2U, 0xCBFA09E3U, 0xFDFE09E4U, 0xECC009E5U, 0xD4A509E6U, 0xDFA209E7U,
+    0xE4BF09E8U, 0xB5BB09E9U, 0xA53E09EAU, 0xB75E09EBU, 0xBDF609ECU, 0xA68509EDU, 0xB1B509EEU, 0xB0E709EFU,
+    0xBCEF09F0U, 0xADCC09F1U, 0xC4B009F2U, 0xA27809F3U, 0x89EC09F4U, 0xE2D009F5U, 0xE2BB09F6U, 0xE5C409F7U,
+    0x815409F8U, 0x9E3F09F9U, 0xCB0409FAU, 0xC72D09FBU, 0xEA3509FCU, 0x8C9209FDU, 0xB1A809FEU, 0x906709FFU,
+    0xF4610A00U, 0xAD240A01U, 0xAA030A02U, 0xAC4E0A03U, 0xE69B0A04U, 0xC2240A05U, 0xACE80A06U, 0xD3270A07U,
+    0xACB60A08U, 0xDA4F0A09U, 0xB5D00A0AU, 0xD8D40A0BU, 0x9E770A0CU, 0xC6250A0DU, 0xB48A0A0EU, 0x88B30A0FU,
+    0xE77A0A10U, 0xF4C00A11U, 0x92DD0A12U, 0xD9290A13U, 0xD6E70A14U, 0xE2B80A15U, 0xE1670A16U, 0xF12E0A17U,
+    0xDB700A18U, 0xC6BA0A19U, 0xFCF50A1AU, 0xE0100A1BU, 0x89830A1CU, 0x89200A1DU, 0xC7A80A1EU, 0xFF820A1FU,
+    0xAA140A20U, 0xBC690A21U, 0xFFFC0A22U, 0x8E290A23U, 0x870F0A24U, 0xF8A80A25U, 0x81030A26U, 0x9E530A27U,
+    0x8E120A28U, 0xDC290A29U, 0x930E0A2AU, 0xB0A80A2BU, 0xD5270A2CU, 0xCA2F0A2DU, 0x81990A2EU, 0xFE840A2FU,
+    0xD5670A30U, 0xE5F50A31U, 0x84820A32U, 0xA9540A33U, 0xA9B50A34U, 0x91EC0A35U, 0xD9170A36U, 0xAA560A37U,
+    0xBE0C0A38U, 0xF4FA0A39U, 0xDA1A0A3AU, 0xD1100A3BU, 0xE5B10A3CU, 0x85490A3DU, 0xC7C50A3EU, 0x9BF90A3FU,
+    0xCF4D0A40U, 0xD0D20A41U, 0x96700A42U, 0xE9390A43U, 0x8C740A44U, 0xC3B20A45U, 0xC3E10A46U, 0xD8290A47U,
+    0x90C60A48U, 0xF3550A49U, 0x8CAF0A4AU, 0xF7F40A4BU, 0xB1490A4CU, 0xCD920A4DU, 0x99FA0A4EU, 0xF20C0A4FU,
+    0x8BA50A50U, 0xD96C0A51U, 0xAE0E0A52U, 0xDADD0A53U, 0xD4F90A54U, 0xF4710A55U, 0xA1400A56U, 0xDEFD0A57U,
+    0xB8FB0A58U, 0xD48B0A59U, 0xD6AF0A5AU, 0xDF360A5BU, 0x8F230A5CU, 0xD99B0A5DU, 0x830F0A5EU, 0xE2030A5FU,
+    0x90340A60U, 0x963F0A61U, 0xD1CA0A62U, 0xD37B0A63U, 0x876F0A64U, 0xB4290A65U, 0xF1210A66U, 0xDA230A67U,
+    0xF5C20A68U, 0x939E0A69U, 0xBBE00A6AU, 0xB9830A6BU, 0xA4040A6CU, 0xD1120A6DU, 0xAD8E0A6EU, 0xE7E50A6FU,
+    0xDA030A70U, 0x88C80A71U, 0xDA410A72U, 0x97940A73U, 0xF85C0A74U, 0xF6C70A75U, 0xF42C0A76U, 0x854E0A77U,
+    0xC9180A78U, 0xC6AF0A79U, 0xEBBF0A7AU, 0xD3D70A7BU, 0xDD250A7CU, 0xF60F0A7DU, 0xDEE60A7EU, 0xE5070A7FU,
+    0x80F90A80U, 0xF3F70A81U, 0xD7AF0A82U, 0xC3B60A83U, 0xE4E60A84U, 0xF7620A85U, 0xA5DC0A86U, 0xBCAD0A87U,
+    0xEC6B0A88U, 0xD2050A89U, 0x95410A8AU, 0x98CC0A8BU, 0xBEE50A8CU, 0xAC8F0A8DU, 0xC0690A8EU, 0xEAEE0A8FU,
+    0xFD3B0A90U, 0xB4500A91U, 0xE19B0A92U, 0xD98A0A93U, 0xAA550A94U, 0xDC890A95U, 0xCB720A96U, 0xFBFF0A97U,
+    0xFCA30A98U, 0x9DCC0A99U, 0xDE9D0A9AU, 0xA2CA0A9BU, 0xA1260A9CU, 0xEC090A9DU, 0x885A0A9EU, 0xC74E0A9FU,
+    0x95F70AA0U, 0xC72C0AA1U, 0xCFA70AA2U, 0xAFF30AA3U, 0xFFAC0AA4U, 0xE7D40AA5U, 0xB91F0AA6U, 0xD30E0AA7U,
+    0xD7C70AA8U, 0xA5120AA9U, 0xCFE90AAAU, 0xE18A0AABU, 0xED8F0AACU, 0xD1F60AADU, 0x85E40AAEU, 0xDC340AAFU,
+    0x906C0AB0U, 0xBAEE0AB1U, 0x8A100AB2U, 0xC54B0AB3U, 0xCD0A0AB4U, 0xF4FD0AB5U, 0xA2EC0AB6U, 0xAFB90AB7U,
+    0xA9C40AB8U, 0xFE2B0AB9U, 0x91690ABAU, 0xAFE10ABBU, 0xA8140ABCU, 0xB19C0ABDU, 0x8E3C0ABEU, 0x89ED0ABFU,
+    0xC2790AC0U, 0x8DA90AC1U, 0xB2950AC2U, 0xF0750AC3U, 0xC91A0AC4U, 0xA97E0AC5U, 0x81EF0AC6U, 0x8E180AC7U,
+    0x84510AC8U, 0xA2290AC9U, 0xB58B0ACAU, 0xA2500ACBU, 0x97620ACCU, 0xCE870ACDU, 0x96D30ACEU, 0xA38A0ACFU,
+    0xFAF20AD0U, 0xEC9A0AD1U, 0x9F9A0AD2U, 0xD6420AD3U, 0xCBD30AD4U, 0x8DF60AD5U, 0xD9E10AD6U, 0x8DDD0AD7U,
+    0xB68A0AD8U, 0xBC4B0AD9U, 0xF0270ADAU, 0xC1A20ADBU, 0xD3680ADCU, 0xABE10ADDU, 0xF6B50ADEU, 0x95F20ADFU,
+    0x819F0AE0U, 0xE62B0AE1U, 0xB3A50AE2U, 0xAC480AE3U, 0x82C60AE4U, 0xFC030AE5U, 0xC5850AE6U, 0xD0050AE7U,
+    0xBF160AE8U, 0xD8330AE9U, 0xA8F70AEAU, 0xBCCC0AEBU, 0xCC820AECU, 0xFED80AEDU, 0xFFCA0AEEU, 0x84330AEFU,
+    0xE8540AF0U, 0x86060AF1U, 0xCB370AF2U, 0xF3F40AF3U, 0x9B490AF4U, 0xD0B30AF5U, 0x8CF80AF6U, 0xCE190AF7U,
+    0xFE350AF8U, 0x829E0AF9U, 0xD07F0AFAU, 0x93330AFBU, 0xFD330AFCU, 0x8EC30AFDU, 0xD8DB0AFEU, 0xA25E0AFFU,
+    0xC2330B00U, 0xE6180B01U, 0x88D40B02U, 0xDBF00B03U, 0xB1F40B04U, 0xF2280B05U, 0xAA4F0B06U, 0xA0E50B07U,
+    0xE5310B08U, 0xCBBE0B09U, 0xBD140B0AU, 0xBADA0B0BU, 0xC0EC0B0CU, 0xE2EB0B0DU, 0x9FD40B0EU, 0xFAC80B0FU,
+    0xCE2A0B10U, 0xDF520B11U, 0xBD3A0B12U, 0xCBCD0B13U, 0x8EC90B14U, 0xA9AA0B15U, 0x8AD30B16U, 0xA8670B17U,
+    0xD5AF0B18U, 0x8C3A0B19U, 0xCBA30B1AU, 0xC1980B1BU, 0xF3090B1CU, 0xF7410B1DU, 0x9B830B1EU, 0xEECA0B1FU,
+    0xAEE10B20U, 0x95360B21U, 0x88910B22U, 0xC81C0B23U, 0xE3420B24U, 0xBED80B25U, 0xFDD70B26U, 0x884C0B27U,
+    0x9A1C0B28U, 0xC2630B29U, 0xB63C0B2AU, 0xEA6C0B2BU, 0x8B420B2CU, 0x91EE0B2DU, 0xF0FC0B2EU, 0x84220B2FU,
+    0xE35D0B30U, 0xD5ED0B31U, 0xB8F60B32U, 0xCCA00B33U, 0xF8EF0B34U, 0xF6720B35U, 0xABAB0B36U, 0xE5150B37U,
+    0xD84A0B38U, 0xE5C50B39U, 0xDD5A0B3AU, 0xF8610B3BU, 0x999E0B3CU, 0xC39E0B3DU, 0x967E0B3EU, 0x92140B3FU,
+    0xAB300B40U, 0xC5580B41U, 0xAAA20B42U, 0x9A3C0B43U, 0xE65A0B44U, 0xAA870B45U, 0x9ED00B46U, 0xDD3F0B47U,
+    0xB59E0B48U, 0xABC40B49U, 0x9A4A0B4AU, 0x917C0B4BU, 0x8F7B0B4CU, 0xBD7C0B4DU, 0xB4E00B4EU, 0xF7CC0B4FU,
+    0xE8520B50U, 0xD0020B51U, 0xE6830B52U, 0xC1FF0B53U, 0xB99F0B54U, 0x9A940B55U, 0xCB8F0B56U, 0xA49B0B57U,
+    0x91C60B58U, 0xDEE40B59U, 0xC8730B5AU, 0x8BCB0B5BU, 0xCBD00B5CU, 0x8B780B5DU, 0xD3D50B5EU, 0xECC40B5FU,
+    0xAA420B60U, 0xF3930B61U, 0x87BC0B62U, 0x86070B63U, 0xDCC90B64U, 0x9EDF0B65U, 0x803A0B66U, 0xD0E00B67U,
+    0x89BD0B68U, 0x9FD20B69U, 0xB9A10B6AU, 0x8D3B0B6BU, 0x8B660B6CU, 0x86210B6DU, 0xD3C40B6EU, 0xF1720B6FU,
+    0x8A410B70U, 0xF7BB0B71U, 0x88810B72U, 0x817B0B73U, 0xFE0B0B74U, 0xC9E90B75U, 0xF6B40B76U, 0xD0E00B77U,
+    0xA7800B78U, 0xF95F0B79U, 0xC33F0B7AU, 0xAD230B7BU, 0xF9E60B7CU, 0x8DA30B7DU, 0x9C390B7EU, 0xECD70B7FU,
+    0xC4370B80U, 0x850A0B81U, 0xA3680B82U, 0xAAD70B83U, 0xF5CC0B84U, 0xEF980B85U, 0x90690B86U, 0xE7C10B87U,
+    0x84D60B88U, 0x991C0B89U, 0xE37E0B8AU, 0xC2CC0B8BU, 0x9F030B8CU, 0xF6A30B8DU, 0xAD120B8EU, 0xACB50B8FU,
+    0xC0480B90U, 0xFAEB0B91U, 0x9B990B92U, 0xB8E80B93U, 0x8A120B94U, 0xE80A0B95U, 0xFCAE0B96U, 0xECDF0B97U,
+    0xA78B0B98U, 0xB5D40B99U, 0x93690B9AU, 0xEC330B9BU, 0xFB510B9CU, 0xBB6E0B9DU, 0xC1EF0B9EU, 0xBBF80B9FU,
+    0xCD4F0BA0U, 0xB7B80BA1U, 0xFFBE0BA2U, 0xE3060BA3U, 0xC6100BA4U, 0xEEBF0BA5U, 0xE1180BA6U, 0xBCBD0BA7U,
+    0xB15A0BA8U, 0xA46D0BA9U, 0x864A0BAAU, 0xC4FA0BABU, 0x98E40BACU, 0xEF280BADU, 0xC6F00BAEU, 0xE5360BAFU,
+    0xAF040BB0U, 0xE2570BB1U, 0xE0250BB2U, 0x9E7F0BB3U, 0xC8890BB4U, 0xC6810BB5U, 0xBABF0BB6U, 0xFD600BB7U,
+    0xC7F60BB8U, 0xA4E20BB9U, 0xEC0C0BBAU, 0xA8F00BBBU, 0xFBF40BBCU, 0xAA310BBDU, 0xF3200BBEU, 0xBDBA0BBFU,
+    0xCFEF0BC0U, 0xFE9E0BC1U, 0x93260BC2U, 0x93680BC3U, 0x9A2D0BC4U, 0xCBD80BC5U, 0xB65C0BC6U, 0x8E300BC7U,
+    0x99CF0BC8U, 0xADE10BC9U, 0xE58D0BCAU, 0x86790BCBU, 0xAF800BCCU, 0xFA990BCDU, 0xB7C80BCEU, 0xBE220BCFU,
+    0xFC650BD0U, 0xB4670BD1U, 0xE0060BD2U, 0xA3E30BD3U, 0xF40E0BD4U, 0xAA6A0BD5U, 0xEBDC0BD6U, 0xEA940BD7U,
+    0xAF720BD8U, 0xB3870BD9U, 0xA6160BDAU, 0x83A80BDBU, 0xBB4A0BDCU, 0xF3800BDDU, 0xC28C0BDEU, 0x990A0BDFU,
+    0xE92A0BE0U, 0x88F00BE1U, 0xFF3A0BE2U, 0x82470BE3U, 0xEC3D0BE4U, 0xE9FE0BE5U, 0x9A240BE6U, 0xCCB20BE7U,
+    0xA0050BE8U, 0xE4950BE9U, 0xEB9D0BEAU, 0xA0300BEBU, 0x8C940BECU, 0x98000BEDU, 0x83100BEEU, 0xFE870BEFU,
+    0x982C0BF0U, 0x981B0BF1U, 0xF7D50BF2U, 0xE53E0BF3U, 0xB4490BF4U, 0xA61F0BF5U, 0xF3AB0BF6U, 0xF7DE0BF7U,
+    0xF39C0BF8U, 0xF1890BF9U, 0x9C460BFAU, 0xFD660BFBU, 0xB9F80BFCU, 0xAC0E0BFDU, 0x8ACB0BFEU, 0x98150BFFU,
+    0xE2A00C00U, 0xA5620C01U, 0x80F60C02U, 0xD8BB0C03U, 0x80EF0C04U, 0xBEC30C05U, 0xDF220C06U, 0x93CC0C07U,
+    0xE5B40C08U, 0x89DE0C09U, 0x9B0F0C0AU, 0xCB850C0BU, 0x88DB0C0CU, 0xF5D40C0DU, 0xE1710C0EU, 0x864C0C0FU,
+    0xB1980C10U, 0xF9070C11U, 0xFEE60C12U, 0x81D80C13U, 0xB7760C14U, 0xDFFF0C15U, 0x90960C16U, 0x86120C17U,
+    0x807E0C18U, 0xC0B00C19U, 0xD0FA0C1AU, 0xA05A0C1BU, 0xA8FA0C1CU, 0xDEC50C1DU, 0x9BB60C1EU, 0xBF7C0C1FU,
+    0xA2CA0C20U, 0xCA2D0C21U, 0xA4FD0C22U, 0xC2C60C23U, 0xD66B0C24U, 0xB0210C25U, 0xF5580C26U, 0xAE470C27U,
+    0xE5AE0C28U, 0xE0040C29U, 0xAC220C2AU, 0x8DD40C2BU, 0xD2710C2CU, 0x8E2D0C2DU, 0xA8600C2EU, 0xB0770C2FU,
+    0xA2C00C30U, 0xFA640C31U, 0xF3000C32U, 0xAFDA0C33U, 0x803D0C34U, 0xF36E0C35U, 0xDD4C0C36U, 0xBABF0C37U,
+    0xBA510C38U, 0x809E0C39U, 0xA6F70C3AU, 0xA5570C3BU, 0xB0CC0C3CU, 0xDD710C3DU, 0xBDBD0C3EU, 0xA9C20C3FU,
+    0xBDF90C40U, 0xCFD20C41U, 0xD0560C42U, 0xA7190C43U, 0xE7630C44U, 0x92640C45U, 0x804A0C46U, 0xDF080C47U,
+    0xCC130C48U, 0x88A00C49U, 0x81280C4AU, 0xB5C50C4BU, 0x9CDE0C4CU, 0x8C130C4DU, 0xDFDC0C4EU, 0xEA110C4FU,
+    0xA1D30C50U, 0xAED30C51U, 0x93040C52U, 0xED770C53U, 0xAEBE0C54U, 0xF8070C55U, 0xFE6F0C56U, 0xF2D70C57U,
+    0xCFC40C58U, 0x91310C59U, 0xF46B0C5AU, 0x8BCF0C5BU, 0xA1080C5CU, 0xAA020C5DU, 0xEF130C5EU, 0xBCED0C5FU,
+    0xC9270C60U, 0xC3D80C61U, 0x8FC10C62U, 0xCE880C63U, 0xF9520C64U, 0xB4A90C65U, 0x97030C66U, 0xD8820C67U,
+    0xBAD50C68U, 0xF9E90C69U, 0xA0220C6AU, 0xC3890C6BU, 0x855C0C6CU, 0xC6E40C6DU, 0xAB1C0C6EU, 0x88DB0C6FU,
+    0xC5290C70U, 0xC7210C71U, 0x97A00C72U, 0x99400C73U, 0xD4EB0C74U, 0xCE1C0C75U, 0xEBC90C76U, 0xD9530C77U,
+    0xA2CC0C78U, 0xFA070C79U, 0xB7960C7AU, 0x8D000C7BU, 0xBFE30C7CU, 0x93160C7DU, 0xAAF30C7EU, 0xC2F70C7FU,
+    0x91410C80U, 0xA3650C81U, 0xD7F00C82U, 0xDFA70C83U, 0xC6960C84U, 0xEF390C85U, 0xEDF10C86U, 0xBA420C87U,
+    0xF6E50C88U, 0x9DB20C89U, 0xC9BE0C8AU, 0xA75D0C8BU, 0x918B0C8CU, 0xBBFD0C8DU, 0xEF2D0C8EU, 0xE70F0C8FU,
+    0xB5400C90U, 0xA7B90C91U, 0xA34E0C92U, 0xE6AB0C93U, 0x8D5B0C94U, 0xF7330C95U, 0x9DDC0C96U, 0xACB80C97U,
+    0xFAAF0C98U, 0xC8960C99U, 0xFD040C9AU, 0xFF650C9BU, 0xADE40C9CU, 0xCDDA0C9DU, 0xCE050C9EU, 0xF1010C9FU,
+    0xD3B80CA0U, 0x95880CA1U, 0xE0720CA2U, 0x952E0CA3U, 0xC8FF0CA4U, 0xB7B00CA5U, 0xF3CF0CA6U, 0xDC030CA7U,
+    0xAE5A0CA8U, 0xB4E20CA9U, 0xF2DD0CAAU, 0xB1B10CABU, 0x99EE0CACU, 0xD2080CADU, 0xAC5E0CAEU, 0xC5D10CAFU,
+    0xDCCD0CB0U, 0xA5050CB1U, 0xC1E80CB2U, 0xAC5F0CB3U, 0xB4190CB4U, 0xB6400CB5U, 0x94AA0CB6U, 0x90040CB7U,
+    0xDBAF0CB8U, 0x98440CB9U, 0xB6FE0CBAU, 0xD3090CBBU, 0xFB900CBCU, 0xF03C0CBDU, 0x93AE0CBEU, 0xE4D90CBFU,
+    0x8AAB0CC0U, 0xEEF80CC1U, 0xBD9F0CC2U, 0xF6ED0CC3U, 0x97B70CC4U, 0xFB800CC5U, 0xCA6D0CC6U, 0xB78A0CC7U,
+    0xC8E50CC8U, 0xB59C0CC9U, 0xDE920CCAU, 0xFFA90CCBU, 0x846C0CCCU, 0xC9BB0CCDU, 0xD2900CCEU, 0xC4690CCFU,
+    0x992A0CD0U, 0xFC370CD1U, 0xE0190CD2U, 0xA0AD0CD3U, 0xC6300CD4U, 0xA69C0CD5U, 0xD28B0CD6U, 0xE6100CD7U,
+    0xF76F0CD8U, 0xEEB00CD9U, 0x8E840CDAU, 0xA8FB0CDBU, 0xBE810CDCU, 0xDA5D0CDDU, 0xC0060CDEU, 0x9C610CDFU,
+    0xC99E0CE0U, 0xD24E0CE1U, 0xFBC30CE2U, 0x88330CE3U, 0xCDEE0CE4U, 0xBA870CE5U, 0xB2D50CE6U, 0x9CFC0CE7U,
+    0xC4D70CE8U, 0xFC6B0CE9U, 0xFD100CEAU, 0xF9840CEBU, 0x937F0CECU, 0xD02E0CEDU, 0xFE410CEEU, 0xC52E0CEFU,
+    0x9DE20CF0U, 0x9F530CF1U, 0x91C50CF2U, 0xE91D0CF3U, 0xF76E0CF4U, 0xE79F0CF5U, 0xAE480CF6U, 0x81A50CF7U,
+    0x9D410CF8U, 0xE3570CF9U, 0xC5E70CFAU, 0xD5710CFBU, 0xC4BB0CFCU, 0x81D70CFDU, 0xC8320CFEU, 0xE3A10CFFU,
+    0x85CE0D00U, 0xAB140D01U, 0x9AE50D02U, 0xB5180D03U, 0xC7AE0D04U, 0xEA910D05U, 0xD2A90D06U, 0xE1750D07U,
+    0xF82D0D08U, 0xBEE60D09U, 0xA08A0D0AU, 0xAB960D0BU, 0xBF2A0D0CU, 0x8A1E0D0DU, 0xAD2E0D0EU, 0xD2DA0D0FU,
+    0x827D0D10U, 0xFD040D11U, 0xB9D00D12U, 0xCB0A0D13U, 0xD4470D14U, 0xE7410D15U, 0xBC7B0D16U, 0xE8E60D17U,
+    0x8EB60D18U, 0x8BDF0D19U, 0xA8A20D1AU, 0xD4690D1BU, 0x91670D1CU, 0x85F00D1DU, 0x8C030D1EU, 0xF52D0D1FU,
+    0xCA5F0D20U, 0xC4F30D21U, 0xE6570D22U, 0xCAC90D23U, 0xF05A0D24U, 0xF4B20D25U, 0xC7450D26U, 0xAEB60D27U,
+    0xD2380D28U, 0xEC280D29U, 0xCD8E0D2AU, 0xF3240D2BU, 0xC1F80D2CU, 0xCC740D2DU, 0xD1090D2EU, 0xAC5D0D2FU,
+    0x87F70D30U, 0xE16B0D31U, 0xF9690D32U, 0xA0D80D33U, 0x8E130D34U, 0xB03E0D35U, 0xDA730D36U, 0xBF7C0D37U,
+    0xB7800D38U, 0xC9440D39U, 0x9A630D3AU, 0xF49A0D3BU, 0x85430D3CU, 0x995D0D3DU, 0x85490D3EU, 0xA7F10D3FU,
+    0x81D80D40U, 0xCBC70D41U, 0x8AA40D42U, 0xB8D90D43U, 0xA79E0D44U, 0xCFC00D45U, 0xD7800D46U, 0x98890D47U,
+    0x82670D48U, 0x8C590D49U, 0xFBAD0D4AU, 0xB8CC0D4BU, 0x98D20D4CU, 0xA4230D4DU, 0xB8E30D4EU, 0xA3500D4FU,
+    0x99080D50U, 0x890B0D51U, 0xA3700D52U, 0xCEF20D53U, 0xE71E0D54U, 0xF69C0D55U, 0xCB2F0D56U, 0xF0AA0D57U,
+    0xC31F0D58U, 0xFC4E0D59U, 0xAA7D0D5AU, 0xEE770D5BU, 0x9EFC0D5CU, 0xCEC10D5DU, 0x9EE10D5EU, 0xBE740D5FU,
+    0x84970D60U, 0xB7C20D61U, 0xD4A00D62U, 0xD0670D63U, 0xD5980D64U, 0x9C390D65U, 0x9C3C0D66U, 0xE2130D67U,
+    0xB7360D68U, 0xB2F20D69U, 0xD2630D6AU, 0xE0900D6BU, 0xA6530D6CU, 0xA90A0D6DU, 0xDE980D6EU, 0xFE310D6FU,
+    0xA1EE0D70U, 0xD5710D71U, 0xA9270D72U, 0xFE560D73U, 0xF2890D74U, 0xF31A0D75U, 0x82710D76U, 0xE50D0D77U,
+    0x99730D78U, 0xF26B0D79U, 0xD0A30D7AU, 0xF66E0D7BU, 0x9CE50D7CU, 0xD4920D7DU, 0xFC400D7EU, 0xB3810D7FU,
+    0xDD290D80U, 0x9E9E0D81U, 0xA39C0D82U, 0xEBC30D83U, 0xD32E0D84U, 0xECC80D85U, 0xB65D0D86U, 0x8C830D87U,
+    0xE6ED0D88U, 0xAE9D0D89U, 0xF39F0D8AU, 0xF0520D8BU, 0xA7590D8CU, 0xE1E20D8DU, 0x80430D8EU, 0x873B0D8FU,
+    0xA4640D90U, 0xF07D0D91U, 0xCC180D92U, 0xACC80D93U, 0xEBBD0D94U, 0xFF360D95U, 0xB6DD0D96U, 0xF9000D97U,
+    0xD8B30D98U, 0xC7A80D99U, 0xE6400D9AU, 0xC5220D9BU, 0xDDF90D9CU, 0x9EEC0D9DU, 0xC4D40D9EU, 0xD41F0D9FU,
+    0x99350DA0U, 0x93C70DA1U, 0x90330DA2U, 0xF1420DA3U, 0x91870DA4U, 0xEE030DA5U, 0xB3590DA6U, 0x92EC0DA7U,
+    0xBDBA0DA8U, 0x9F710DA9U, 0xBCE70DAAU, 0xB0CA0DABU, 0xC7250DACU, 0xC0350DADU, 0x8FE40DAEU, 0xBD8D0DAFU,
+    0xD6DF0DB0U, 0x938D0DB1U, 0xA9B10DB2U, 0xAED10DB3U, 0xAEEB0DB4U, 0xA6510DB5U, 0x83E00DB6U, 0x91130DB7U,
+    0xD4240DB8U, 0x9E460DB9U, 0xF3100DBAU, 0xA0B70DBBU, 0xE0190DBCU, 0xD5220DBDU, 0x920A0DBEU, 0xB0F70DBFU,
+    0xDEFA0DC0U, 0xB9870DC1U, 0xBDBA0DC2U, 0xD84E0DC3U, 0xF4B30DC4U, 0xB5AB0DC5U, 0xE8440DC6U, 0xFAC00DC7U,
+    0xE1320DC8U, 0xD7060DC9U, 0x80CE0DCAU, 0x809C0DCBU, 0xED9B0DCCU, 0xC88F0DCDU, 0xB3290DCEU, 0xE47B0DCFU,
+    0xED8D0DD0U, 0x9A850DD1U, 0xACCB0DD2U, 0xE1B10DD3U, 0x86640DD4U, 0x9CE90DD5U, 0xAC250DD6U, 0xD3960DD7U,
+    0x8B130DD8U, 0xDD030DD9U, 0xEB7D0DDAU, 0x91D60DDBU, 0xB4260DDCU, 0xF2F10DDDU, 0xB29A0DDEU, 0xAE1A0DDFU,
+    0x9BB40DE0U, 0x84700DE1U, 0xFC6F0DE2U, 0xED750DE3U, 0x97820DE4U, 0xEE740DE5U, 0xA1250DE6U, 0xBA8C0DE7U,
+    0xE8F00DE8U, 0xA7850DE9U, 0xA96A0DEAU, 0xE22C0DEBU, 0x9E1F0DECU, 0xD1D70DEDU, 0x94290DEEU, 0xA3C20DEFU,
+    0xC7E80DF0U, 0xFD690DF1U, 0xD3440DF2U, 0xD1DE0DF3U, 0x8A8E0DF4U, 0x9AA60DF5U, 0x9F2C0DF6U, 0xC6380DF7U,
+    0xA0620DF8U, 0x81ED0DF9U, 0xB8590DFAU, 0xEB2A0DFBU, 0x9B6B0DFCU, 0xD1410DFDU, 0xFF570DFEU, 0xF65E0DFFU,
+    0xB8950E00U, 0x8B190E01U, 0xBBE70E02U, 0xEFAD0E03U, 0x98E00E04U, 0x84020E05U, 0x8C640E06U, 0xE07B0E07U,
+    0x89D90E08U, 0x840C0E09U, 0xFDA90E0AU, 0xA8CB0E0BU, 0x815E0E0CU, 0xBED70E0DU, 0xE5FF0E0EU, 0xC7600E0FU,
+    0xA1710E10U, 0xFB8C0E11U, 0xE7CF0E12U, 0xC1410E13U, 0x818E0E14U, 0x847B0E15U, 0xD7DB0E16U, 0xD48A0E17U,
+    0x8D590E18U, 0xE7C50E19U, 0x98640E1AU, 0xB6750E1BU, 0x9E6F0E1CU, 0xDF5D0E1DU, 0xC2750E1EU, 0xB3D30E1FU,
+    0xA6BB0E20U, 0xF7790E21U, 0xF6860E22U, 0xBBA50E23U, 0xE9E20E24U, 0x81270E25U, 0x98680E26U, 0xBDDA0E27U,
+    0x8E220E28U, 0xDAB20E29U, 0xEEC70E2AU, 0xDA570E2BU, 0xA2240E2CU, 0xEAFF0E2DU, 0xDF030E2EU, 0xF9980E2FU,
+    0x84B60E30U, 0xBE7A0E31U, 0xAD900E32U, 0xB7CD0E33U, 0xB2A20E34U, 0xA0F60E35U, 0xDC6F0E36U, 0xC50C0E37U,
+    0xADEE0E38U, 0xB1020E39U, 0xB2150E3AU, 0xA5050E3BU, 0xD9BA0E3CU, 0xE03F0E3DU, 0xE6870E3EU, 0xC1FE0E3FU,
+    0xF2B50E40U, 0xFE9E0E41U, 0xC2AC0E42U, 0x9B2E0E43U, 0xA4350E44U, 0xA4330E45U, 0xE1B10E46U, 0x8CEB0E47U,
+    0xDD270E48U, 0x9DF50E49U, 0x95EB0E4AU, 0xCE450E4BU, 0x9E4E0E4CU, 0x936C0E4DU, 0xC1E10E4EU, 0xEF4F0E4FU,
+    0xBD620E50U, 0xA3090E51U, 0xC6F90E52U, 0xB9F90E53U, 0xFD620E54U, 0x99930E55U, 0xF6CA0E56U, 0xCFDB0E57U,
+    0xA1940E58U, 0xB26D0E59U, 0x9DA20E5AU, 0x8CE70E5BU, 0xD0090E5CU, 0xF9160E5DU, 0xD8C20E5EU, 0xF7BD0E5FU,
+    0x90CD0E60U, 0x8D5A0E61U, 0xFFF50E62U, 0xC7FA0E63U, 0x93270E64U, 0xB7620E65U, 0xCACD0E66U, 0xE0960E67U,
+    0xC2D00E68U, 0x96AA0E69U, 0xEC4C0E6AU, 0x828C0E6BU, 0xD4E40E6CU, 0x8F1D0E6DU, 0x8DAA0E6EU, 0x8A490E6FU,
+    0x9F4B0E70U, 0xFEC40E71U, 0x9CEE0E72U, 0xEFAD0E73U, 0xE7110E74U, 0xA2C00E75U, 0xDCA60E76U, 0xB8D40E77U,
+    0x8A380E78U, 0xB9B20E79U, 0xF8750E7AU, 0xF6870E7BU, 0xC0B10E7CU, 0xA9940E7DU, 0x81340E7EU, 0xC41E0E7FU,
+    0xBC8A0E80U, 0xA0510E81U, 0xD3D40E82U, 0xD2A50E83U, 0xFD710E84U, 0xD9D60E85U, 0x93DC0E86U, 0xCC7C0E87U,
+    0xD1FD0E88U, 0xE24A0E89U, 0xB7510E8AU, 0xF8730E8BU, 0xAC6B0E8CU, 0xAF0A0E8DU, 0xE4B90E8EU, 0xF9920E8FU,
+    0xF3D00E90U, 0x85B90E91U, 0xCE5C0E92U, 0x85350E93U, 0xBDD70E94U, 0xB40B0E95U, 0xCCAA0E96U, 0xE5A10E97U,
+    0x93110E98U, 0xC2D60E99U, 0x9FD90E9AU, 0xBC2E0E9BU, 0xBDD30E9CU, 0x84890E9DU, 0xE0B10E9EU, 0xD9570E9FU,
+    0x89710EA0U, 0xACBB0EA1U, 0xEC0A0EA2U, 0xD8800EA3U, 0xB1C20EA4U, 0x998B0EA5U, 0x930B0EA6U, 0xDD470EA7U,
+    0xD0CC0EA8U, 0x8F2B0EA9U, 0x8F0F0EAAU, 0xFD170EABU, 0xFAFF0EACU, 0xA6DE0EADU, 0xF0110EAEU, 0xCA2E0EAFU,
+    0xDA2F0EB0U, 0xBE4A0EB1U, 0xCDBD0EB2U, 0xC1EC0EB3U, 0xBD870EB4U, 0xB96A0EB5U, 0x88950EB6U, 0xC3110EB7U,
+    0x94D40EB8U, 0x996E0EB9U, 0xC9530EBAU, 0x9A210EBBU, 0xD1460EBCU, 0xFFCF0EBDU, 0xDCE70EBEU, 0xE7920EBFU,
+    0x85110EC0U, 0x847A0EC1U, 0xEBDC0EC2U, 0xA5650EC3U, 0xC8150EC4U, 0xCC770EC5U, 0xAD1D0EC6U, 0xD3D30EC7U,
+    0xF12D0EC8U, 0xE89F0EC9U, 0xED090ECAU, 0xB6620ECBU, 0x838D0ECCU, 0xA9CD0ECDU, 0xEE530ECEU, 0xACF60ECFU,
+    0xC61A0ED0U, 0x936C0ED1U, 0x8E290ED2U, 0xE3220ED3U, 0xAB370ED4U, 0x8D3B0ED5U, 0xA3BC0ED6U, 0xE4F20ED7U,
+    0xB3F70ED8U, 0xC44D0ED9U, 0xEFE60EDAU, 0x8D000EDBU, 0xB5620EDCU, 0x9AD80EDDU, 0xC1040EDEU, 0x890A0EDFU,
+    0xC9210EE0U, 0xE6570EE1U, 0xAB2E0EE2U, 0xAA770EE3U, 0xF8230EE4U, 0xFBE30EE5U, 0xEA320EE6U, 0xB5D00EE7U,
+    0xE5100EE8U, 0xA2790EE9U, 0xFE410EEAU, 0xBB760EEBU, 0xA7F70EECU, 0xF3550EEDU, 0x996E0EEEU, 0x951A0EEFU,
+    0xE0360EF0U, 0xEBEE0EF1U, 0xDFEE0EF2U, 0x890A0EF3U, 0xF6450EF4U, 0xD5B70EF5U, 0xE95C0EF6U, 0x816F0EF7U,
+    0xADD70EF8U, 0xBE4D0EF9U, 0x82990EFAU, 0xC05B0EFBU, 0xB3E30EFCU, 0xA8DD0EFDU, 0xFEAF0EFEU, 0x84FE0EFFU,
+    0xF6140F00U, 0xA4E80F01U, 0xEC4E0F02U, 0xCB170F03U, 0xA7D50F04U, 0xE8FF0F05U, 0xA1690F06U, 0xB0BF0F07U,
+    0x85970F08U, 0xB7540F09U, 0x8E7D0F0AU, 0xC4560F0BU, 0xAE9F0F0CU, 0x819B0F0DU, 0xB2530F0EU, 0xB38D0F0FU,
+    0xEA010F10U, 0xFC640F11U, 0xEA1A0F12U, 0x87580F13U, 0xB2730F14U, 0xDD030F15U, 0x97460F16U, 0x83A80F17U,
+    0xC1E60F18U, 0xC31E0F19U, 0xFBAE0F1AU, 0xA44D0F1BU, 0xF9B30F1CU, 0xA23A0F1DU, 0xA9B30F1EU, 0xFA5D0F1FU,
+    0xA76A0F20U, 0xB8E00F21U, 0xDAB20F22U, 0xC8470F23U, 0xE2390F24U, 0xDF2A0F25U, 0xD0090F26U, 0xD31B0F27U,
+    0xF1E10F28U, 0x8EF00F29U, 0xC9B00F2AU, 0x96380F2BU, 0xE0C40F2CU, 0x917E0F2DU, 0xC8DE0F2EU, 0x94D70F2FU,
+    0x82000F30U, 0xAEB80F31U, 0xEE110F32U, 0x966F0F33U, 0xDCAD0F34U, 0xDE6F0F35U, 0xAE450F36U, 0xAF180F37U,
+    0xDD480F38U, 0xAF910F39U, 0xC8D40F3AU, 0xDFFA0F3BU, 0xDA6B0F3CU, 0xBD5B0F3DU, 0xE6A30F3EU, 0xADD50F3FU,
+    0xF47A0F40U, 0xE2A40F41U, 0xB3980F42U, 0x872F0F43U, 0xED1D0F44U, 0xEA6D0F45U, 0xED700F46U, 0xE56A0F47U,
+    0xB1990F48U, 0xD4040F49U, 0xB30D0F4AU, 0x81030F4BU, 0xCBFD0F4CU, 0x886B0F4DU, 0xE53D0F4EU, 0xC4130F4FU,
+    0xEEBB0F50U, 0xE2830F51U, 0x978C0F52U, 0xC3760F53U, 0x9B4E0F54U, 0xAD4A0F55U, 0xE9620F56U, 0xBCB70F57U,
+    0x8B2A0F58U, 0x9A340F59U, 0xFD2B0F5AU, 0xB54B0F5BU, 0xFD540F5CU, 0x891B0F5DU, 0xEF1D0F5EU, 0xF4B00F5FU,
+    0xE12C0F60U, 0x89040F61U, 0xFB190F62U, 0xE4550F63U, 0xAFA80F64U, 0x89500F65U, 0xCB4D0F66U, 0xC97A0F67U,
+    0xD7E20F68U, 0x96F90F69U, 0x8EC30F6AU, 0xAFB80F6BU, 0x8C180F6CU, 0xB0590F6DU, 0xADAE0F6EU, 0xD1350F6FU,
+    0xE87E0F70U, 0xF0D00F71U, 0xB1030F72U, 0x9E2D0F73U, 0xE7FD0F74U, 0x923B0F75U, 0xCEA80F76U, 0xA2040F77U,
+    0x86460F78U, 0xB7500F79U, 0x912E0F7AU, 0xC4720F7BU, 0xE23F0F7CU, 0xC22B0F7DU, 0xCE900F7EU, 0x94930F7FU,
+    0xE8C40F80U, 0x94D30F81U, 0xEDEE0F82U, 0xB4400F83U, 0xCC580F84U, 0x85A70F85U, 0xF4FD0F86U, 0xBFCB0F87U,
+    0xD4180F88U, 0xC6F30F89U, 0x9F2F0F8AU, 0xB43D0F8BU, 0xF4D90F8CU, 0xCF4F0F8DU, 0xCB170F8EU, 0x97950F8FU,
+    0x98DB0F90U, 0xDD650F91U, 0x94C80F92U, 0xFBA10F93U, 0xB20A0F94U, 0xA22E0F95U, 0xE85E0F96U, 0xD0BB0F97U,
+    0xD6640F98U, 0xCEFC0F99U, 0xC6A70F9AU, 0xDE2F0F9BU, 0xE1B80F9CU, 0xB73A0F9DU, 0xAB640F9EU, 0xE3990F9FU,
+    0xE7220FA0U, 0xE12F0FA1U, 0xE39D0FA2U, 0x90230FA3U, 0xA9DE0FA4U, 0xDCB50FA5U, 0x8C550FA6U, 0xED260FA7U,
+    0x8C340FA8U, 0xE5200FA9U, 0xDC850FAAU, 0xA5C80FABU, 0xB7A20FACU, 0xA5130FADU, 0xC5090FAEU, 0xB37F0FAFU,
+    0xF1F60FB0U, 0xBD600FB1U, 0x87790FB2U, 0xDA830FB3U, 0xB5240FB4U, 0x95430FB5U, 0xD2020FB6U, 0x88DB0FB7U,
+    0xCBB90FB8U, 0xFBEF0FB9U, 0xBF570FBAU, 0xB9E10FBBU, 0x81740FBCU, 0xAC610FBDU, 0xA6FC0FBEU, 0x97D50FBFU,
+    0xC1F80FC0U, 0xCFED0FC1U, 0xDA930FC2U, 0xECC10FC3U, 0xCA3B0FC4U, 0xCF260FC5U, 0x9DA90FC6U, 0xC1F50FC7U,
+    0xA97C0FC8U, 0x88CF0FC9U, 0xA3750FCAU, 0x9E560FCBU, 0xE4310FCCU, 0xFD480FCDU, 0xBD4A0FCEU, 0x9C830FCFU,
+    0xC6C50FD0U, 0xE4B60FD1U, 0xE23F0FD2U, 0xA4BD0FD3U, 0x918F0FD4U, 0x8F660FD5U, 0xF4E80FD6U, 0x9CDB0FD7U,
+    0xC9CC0FD8U, 0xDD3F0FD9U, 0xA7110FDAU, 0xAF960FDBU, 0xDC9D0FDCU, 0xFFBD0FDDU, 0xB48F0FDEU, 0xACC10FDFU,
+    0xDBB70FE0U, 0xBD560FE1U, 0xACF60FE2U, 0xACF00FE3U, 0xE50D0FE4U, 0xD78B0FE5U, 0xF1010FE6U, 0x8DAF0FE7U,
+    0xF7450FE8U, 0x81330FE9U, 0xC0C00FEAU, 0xAF4A0FEBU, 0xD3EE0FECU, 0xFEDD0FEDU, 0xD5450FEEU, 0xD8D50FEFU,
+    0xC8A70FF0U, 0xE4950FF1U, 0xBB720FF2U, 0xAA010FF3U, 0xC2220FF4U, 0xD7540FF5U, 0x92530FF6U, 0x8A310FF7U,
+    0xCBA20FF8U, 0xF3180FF9U, 0xACD40FFAU, 0xAD600FFBU, 0xFBC80FFCU, 0xB76E0FFDU, 0xE4880FFEU, 0xE6010FFFU,
+};
+
+static uint32_t const dcmt2203_twists[] =
+{
+    0xC1D70000U, 0xD53F0001U, 0xDB030002U, 0xCBD10003U, 0xE4080004U, 0xB1910005U, 0xCB620006U, 0xF98C0007U,
+    0xD6150008U, 0xCA2B0009U, 0xF52F000AU, 0xD283000BU, 0xC3EE000CU, 0xFB73000DU, 0xDDBC000EU, 0xB664000FU,
+    0xADDE0010U, 0xA0CC0011U, 0xF11F0012U, 0xB3BD0013U, 0xA9C90014U, 0xB6460015U, 0x8A550016U, 0xD98E0017U,
+    0x88B50018U, 0x942E0019U, 0xEB80001AU, 0x8C5A001BU, 0xA313001CU, 0x9DB1001DU, 0xF62F001EU, 0xBB7F001FU,
+    0x89490020U, 0xA4790021U, 0x97FA0022U, 0xD3000023U, 0xBE670024U, 0x9E450025U, 0xB5260026U, 0xF0550027U,
+    0x9D2F0028U, 0xCD920029U, 0x8E30002AU, 0x80E7002BU, 0x8DCD002CU, 0x98A8002DU, 0xBD1F002EU, 0xDA2A002FU,
+    0xFC390030U, 0xCB570031U, 0xC44C0032U, 0xBD650033U, 0xCBE20034U, 0x930E0035U, 0xF6C00036U, 0xD5A60037U,
+    0xD9D50038U, 0xADF60039U, 0xAC68003AU, 0xD182003BU, 0xB3D6003CU, 0xA7CF003DU, 0xD9BC003EU, 0xCDDE003FU,
+    0xE9E80040U, 0x810F0041U, 0xD3AA0042U, 0x8DAA0043U, 0xB3C20044U, 0xAFDD0045U, 0xCCF10046U, 0xEEE80047U,
+    0x867D0048U, 0xB6260049U, 0xECA2004AU, 0x8509004BU, 0xB4D2004CU, 0xEDC0004DU, 0xCDF8004EU, 0x8D15004FU,
+    0x95100050U, 0x8D290051U, 0xF51D0052U, 0xBB940053U, 0xC4220054U, 0xA33F0055U, 0xCAD70056U, 0xE1130057U,
+    0x956A0058U, 0xF5A20059U, 0xD2D2005AU, 0xC34D005BU, 0xD95F005CU, 0x846F005DU, 0xA70A005EU, 0xA758005FU,
+    0xA0B70060U, 0x8A4F0061U, 0xF4910062U, 0xB4B70063U, 0xF54C0064U, 0xA95F0065U, 0xF8570066U, 0xFD120067U,
+    0x972F0068U, 0xE6800069U, 0xEDA7006AU, 0xAF62006BU, 0xADB3006CU, 0x9C57006DU, 0x9F29006EU, 0xD369006FU,
+    0xF5870070U, 0xC95A0071U, 0x8B3C0072U, 0xAA810073U, 0xE8A60074U, 0xE6C40075U, 0xA7030076U, 0xCDA60077U,
+    0xEAAE0078U, 0x81740079U, 0x9956007AU, 0xFCBB007BU, 0xA027007CU, 0xE0D2007DU, 0xE675007EU, 0xEF78007FU,
+    0xC5EC0080U, 0x83720081U, 0xF4CF0082U, 0xD1C10083U, 0x89430084U, 0xB8070085U, 0xCBC80086U, 0xDAAA0087U,
+    0xC47F0088U, 0xA93A0089U, 0xE250008AU, 0xCDD7008BU, 0xA38B008CU, 0x99BF008DU, 0x84AC008EU, 0xFA2A008FU,
+    0xB9A50090U, 0xFE4E0091U, 0xB2090092U, 0x9D9F0093U, 0x8B0C0094U, 0xDA900095U, 0xD2770096U, 0xA8C20097U,
+    0xDAC80098U, 0xECDB0099U, 0xADEB009AU, 0x898D009BU, 0xF80D009CU, 0xCAFE009DU, 0xCF5A009EU, 0xD416009FU,
+    0xE1F300A0U, 0x87EB00A1U, 0xD5F900A2U, 0xF15D00A3U, 0xE6B200A4U, 0x822000A5U, 0xD63700A6U, 0xCBEB00A7U,
+    0xBBA300A8U, 0xB63600A9U, 0xAF9B00AAU, 0xB85900ABU, 0xBEBA00ACU, 0xFD2100ADU, 0xC6B400AEU, 0x9C8A00AFU,
+    0x863900B0U, 0xCD7100B1U, 0xC20800B2U, 0xE5D400B3U, 0xD18400B4U, 0xAFE200B5U, 0xA11400B6U, 0xC8B100B7U,
+    0xEB2700B8U, 0xE50A00B9U, 0xEA8D00BAU, 0xC34C00BBU, 0xC1A600BCU, 0xC03D00BDU, 0xC98B00BEU, 0x802C00BFU,
+    0xCE0600C0U, 0x9AD100C1U, 0xF3CC00C2U, 0xCEC200C3U, 0xD9E500C4U, 0xBD1100C5U, 0xC3A800C6U, 0x8F2200C7U,
+    0xBD1200C8U, 0xEAE600C9U, 0xDF8400CAU, 0xF3B400CBU, 0xAD9E00CCU, 0xA2A700CDU, 0x89C500CEU, 0xD8A000CFU,
+    0xBFFF00D0U, 0xF71700D1U, 0xEAC600D2U, 0xEB6C00D3U, 0x881E00D4U, 0xE5AA00D5U, 0xF41700D6U, 0xF13200D7U,
+    0x8A7D00D8U, 0xEBC800D9U, 0xD27400DAU, 0xE7CF00DBU, 0xACCC00DCU, 0xA6E000DDU, 0xB9D600DEU, 0x831800DFU,
+    0xA40000E0U, 0xF72900E1U, 0xF14400E2U, 0xDF9400E3U, 0xF09300E4U, 0xADF900E5U, 0xBDD400E6U, 0xF02000E7U,
+    0xDEB900E8U, 0xCA2B00E9U, 0xE9F300EAU, 0x86D000EBU, 0xDCE100ECU, 0x946C00EDU, 0xAB9000EEU, 0xAFCA00EFU,
+    0xC29300F0U, 0xCFE400F1U, 0xEADB00F2U, 0xBC7100F3U, 0xE01C00F4U, 0x989800F5U, 0xE39F00F6U, 0x8B8600F7U,
+    0xE89600F8U, 0xCBD600F9U, 0xBC9D00FAU, 0xFB4A00FBU, 0x83AB00FCU, 0xA25A00FDU, 0xF75200FEU, 0xCA6600FFU,
+};
@@ -10,6 +10,70 @@
 
 #include "mt19937.h"
 
+/******************************************************************************
+ * Static probes, which tracers such as `bpftrace` and `perf` can attach to in
+ * a running program. Each is a single `nop` instruction unless a tracer is
+ * attached. They are compiled in if `sys/sdt.h` (provided by SystemTap) is
+ * available, unless `MT19937_NO_PROBES` is defined.
+ *
+ * The first two arguments of every probe are the word width (32 or 64) and the
+ * address of the MT19937 object.
+ *****************************************************************************/
+#if !defined MT19937_NO_PROBES && defined __has_include
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define MT19937_PROBE2(name, a, b) DTRACE_PROBE2(mt19937, name, a, b)
+#define MT19937_PROBE3(name, a, b, c) DTRACE_PROBE3(mt19937, name, a, b, c)
+#define MT19937_PROBE4(name, a, b, c, d) DTRACE_PROBE4(mt19937, name, a, b, c, d)
+#endif
+#endif
+#ifndef MT19937_PROBE2
+#define MT19937_PROBE2(name, a, b) ((void)0)
+#define MT19937_PROBE3(name, a, b, c) ((void)0)
+#define MT19937_PROBE4(name, a, b, c, d) ((void)0)
+#endif
+
+/******************************************************************************
+ * Count calls, twists, rejections and steps if instrumentation is enabled.
+ * Otherwise, do nothing.
+ *
+ * Since the internal object is used whenever `mt` is `NULL`, the counters must
+ * be selected before `mt` is replaced with its address.
+ *****************************************************************************/
+#ifdef MT19937_STATS
+#define MT19937_STATS_SELECT(mt)  \
+struct mt19937_stats_t *stats = (mt) == NULL ? &MT19937_STATS_OBJECT : &(mt)->stats;
+#define MT19937_STATS_COUNT(member, amount) (stats->member += (amount))
+#else
+#define MT19937_STATS_SELECT(mt)
+#define MT19937_STATS_COUNT(member, amount) ((void)0)
+#endif
+
+/******************************************************************************
+ * Compile the functions which generate numbers for the baseline x86-64
+ * instruction set and for the x86-64-v2, x86-64-v3 (AVX2) and x86-64-v4
+ * (AVX-512) microarchitecture levels. The dynamic linker selects the best one
+ * the processor supports when resolving the symbol (using an indirect function
+ * resolver). This requires an ELF target with the GNU C library, so it is done
+ * only there, unless `MT19937_NO_MULTIVERSION` is defined.
+ *
+ * Helper functions must be inlined into each of these. If a helper were not
+ * (which GCC may decide with profile-guided optimisation), all versions would
+ * call one copy of it compiled for the baseline instruction set.
+ *****************************************************************************/
+#if !defined MT19937_NO_MULTIVERSION && defined __x86_64__ && defined __ELF__ && defined __GLIBC__  \
+    && defined __has_attribute
+#if __has_attribute(target_clones)
+#define MT19937_CLONES  \
+__attribute__((target_clones("default", "arch=x86-64-v2", "arch=x86-64-v3", "arch=x86-64-v4")))
+#define MT19937_ALWAYS_INLINE __attribute__((always_inline))
+#endif
+#endif
+#ifndef MT19937_CLONES
+#define MT19937_CLONES
+#define MT19937_ALWAYS_INLINE
+#endif
+
 /******************************************************************************
  * Calculate the hash of an object. Use Daniel J. Bernstein's hash function;
  * temper the result.
@@ -49,6 +113,12 @@ static int long long unsigned djb2t(void *data, size_t size)
 #define MT19937_REAL mt19937_real32
 #define MT19937_SHUF mt19937_shuf32
 #define MT19937_DROP mt19937_drop32
+#define MT19937_BACK mt19937_back32
+#define MT19937_FILL mt19937_fill32
+#define MT19937_TWIST mt19937_twist32
+#define MT19937_STATS_GET mt19937_stats_get32
+#define MT19937_STATS_RESET mt19937_stats_reset32
+#define MT19937_STATS_OBJECT mt19937_32_stats
 #define MT19937_STATE_LENGTH 624
 #define MT19937_STATE_MIDDLE 397
 #define MT19937_MASK_UPPER 0x80000000U
@@ -147,9 +217,19 @@ static MT19937_OBJECT_TYPE MT19937_OBJECT =
     },
     {0},
     MT19937_STATE_LENGTH,
+#ifdef MT19937_STATS
+    {0},
+#endif
 };
 
+// The internal object is not thread-safe, but its counters are kept per
+// thread, so that they show which threads use it.
+#ifdef MT19937_STATS
+static _Thread_local struct mt19937_stats_t MT19937_STATS_OBJECT;
+#endif
+
 #include "mt19937_defs.c"
+#include "common_defs.c"
 
 #undef MT19937_WORD
 #undef MT19937_WORD_SIGNED
@@ -166,6 +246,12 @@ static MT19937_OBJECT_TYPE MT19937_OBJECT =
 #undef MT19937_REAL
 #undef MT19937_SHUF
 #undef MT19937_DROP
+#undef MT19937_BACK
+#undef MT19937_FILL
+#undef MT19937_TWIST
+#undef MT19937_STATS_GET
+#undef MT19937_STATS_RESET
+#undef MT19937_STATS_OBJECT
 #undef MT19937_STATE_LENGTH
 #undef MT19937_STATE_MIDDLE
 #undef MT19937_MASK_UPPER
@@ -198,6 +284,12 @@ static MT19937_OBJECT_TYPE MT19937_OBJECT =
 #define MT19937_REAL mt19937_real64
 #define MT19937_SHUF mt19937_shuf64
 #define MT19937_DROP mt19937_drop64
+#define MT19937_BACK mt19937_back64
+#define MT19937_FILL mt19937_fill64
+#define MT19937_TWIST mt19937_twist64
+#define MT19937_STATS_GET mt19937_stats_get64
+#define MT19937_STATS_RESET mt19937_stats_reset64
+#define MT19937_STATS_OBJECT mt19937_64_stats
 #define MT19937_STATE_LENGTH 312
 #define MT19937_STATE_MIDDLE 156
 #define MT19937_MASK_UPPER 0xFFFFFFFF80000000U
@@ -296,9 +388,490 @@ static MT19937_OBJECT_TYPE MT19937_OBJECT =
     },
     {0},
     MT19937_STATE_LENGTH,
+#ifdef MT19937_STATS
+    {0},
+#endif
+};
+
+// The internal object is not thread-safe, but its counters are kept per
+// thread, so that they show which threads use it.
+#ifdef MT19937_STATS
+static _Thread_local struct mt19937_stats_t MT19937_STATS_OBJECT;
+#endif
+
+#include "mt19937_defs.c"
+#include "common_defs.c"
+
+#undef MT19937_WORD
+#undef MT19937_WORD_SIGNED
+#undef MT19937_WORD_WIDTH
+#undef MT19937_WORD_MAX
+#undef MT19937_OBJECT_TYPE
+#undef MT19937_OBJECT
+#undef MT19937_REAL_TYPE
+#undef MT19937_SEED
+#undef MT19937_INIT
+#undef MT19937_RAND
+#undef MT19937_UINT
+#undef MT19937_SPAN
+#undef MT19937_REAL
+#undef MT19937_SHUF
+#undef MT19937_DROP
+#undef MT19937_BACK
+#undef MT19937_FILL
+#undef MT19937_TWIST
+#undef MT19937_STATS_GET
+#undef MT19937_STATS_RESET
+#undef MT19937_STATS_OBJECT
+#undef MT19937_STATE_LENGTH
+#undef MT19937_STATE_MIDDLE
+#undef MT19937_MASK_UPPER
+#undef MT19937_MASK_LOWER
+#undef MT19937_MASK_TWIST
+#undef MT19937_MULTIPLIER
+#undef MT19937_TEMPER_B
+#undef MT19937_TEMPER_C
+#undef MT19937_TEMPER_D
+#undef MT19937_TEMPER_I
+#undef MT19937_TEMPER_S
+#undef MT19937_TEMPER_T
+#undef MT19937_TEMPER_U
+
+/******************************************************************************
+ * Philox4x32-10.
+ *****************************************************************************/
+#define MT19937_WORD uint32_t
+#define MT19937_WORD_SIGNED int32_t
+#define MT19937_WORD_WIDTH 32
+#define MT19937_WORD_MAX 0xFFFFFFFFU
+#define MT19937_OBJECT_TYPE struct philox_32_t
+#define MT19937_OBJECT philox_32
+#define MT19937_REAL_TYPE double
+#define MT19937_SEED philox_seed32
+#define MT19937_INIT philox_init32
+#define MT19937_RAND philox_rand32
+#define MT19937_UINT philox_uint32
+#define MT19937_SPAN philox_span32
+#define MT19937_REAL philox_real32
+#define MT19937_SHUF philox_shuf32
+#define MT19937_DROP philox_drop32
+#define MT19937_FILL philox_fill32
+#define MT19937_SEEK philox_seek32
+#define MT19937_BIJECT philox_biject32
+#define MT19937_ADVANCE philox_advance32
+#define PHILOX_MULTIPLIER_0 0xD2511F53U
+#define PHILOX_MULTIPLIER_1 0xCD9E8D57U
+#define PHILOX_WEYL_0 0x9E3779B9U
+#define PHILOX_WEYL_1 0xBB67AE85U
+#define PHILOX_ROUNDS 10
+#define PHILOX_LANES 16
+
+// The counter is one less than zero, so that the first number generated is
+// the first word of the transformed zero counter.
+static MT19937_OBJECT_TYPE MT19937_OBJECT =
+{
+    {5489, 0},
+    {0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU},
+    {0},
+    4,
+};
+
+// Instrumentation counters and static probes are available only for MT19937.
+// (The probes identify objects by word width and address alone, so other
+// generators firing them could not be told apart from MT19937.)
+#undef MT19937_STATS_SELECT
+#undef MT19937_STATS_COUNT
+#define MT19937_STATS_SELECT(mt)
+#define MT19937_STATS_COUNT(member, amount) ((void)0)
+#undef MT19937_PROBE2
+#undef MT19937_PROBE3
+#undef MT19937_PROBE4
+#define MT19937_PROBE2(name, a, b) ((void)0)
+#define MT19937_PROBE3(name, a, b, c) ((void)0)
+#define MT19937_PROBE4(name, a, b, c, d) ((void)0)
+
+#include "philox_defs.c"
+#include "common_defs.c"
+
+#undef MT19937_WORD
+#undef MT19937_WORD_SIGNED
+#undef MT19937_WORD_WIDTH
+#undef MT19937_WORD_MAX
+#undef MT19937_OBJECT_TYPE
+#undef MT19937_OBJECT
+#undef MT19937_REAL_TYPE
+#undef MT19937_SEED
+#undef MT19937_INIT
+#undef MT19937_RAND
+#undef MT19937_UINT
+#undef MT19937_SPAN
+#undef MT19937_REAL
+#undef MT19937_SHUF
+#undef MT19937_DROP
+#undef MT19937_FILL
+#undef MT19937_SEEK
+#undef MT19937_BIJECT
+#undef MT19937_ADVANCE
+#undef PHILOX_MULTIPLIER_0
+#undef PHILOX_MULTIPLIER_1
+#undef PHILOX_WEYL_0
+#undef PHILOX_WEYL_1
+#undef PHILOX_ROUNDS
+#undef PHILOX_LANES
+
+/******************************************************************************
+ * xoshiro256**.
+ *****************************************************************************/
+#define MT19937_WORD uint64_t
+#define MT19937_WORD_SIGNED int64_t
+#define MT19937_WORD_WIDTH 64
+#define MT19937_WORD_MAX 0xFFFFFFFFFFFFFFFFU
+#define MT19937_OBJECT_TYPE struct xoshiro256ss_64_t
+#define MT19937_OBJECT xoshiro256ss_64
+#define MT19937_REAL_TYPE double long
+#define MT19937_SEED xoshiro256ss_seed64
+#define MT19937_INIT xoshiro256ss_init64
+#define MT19937_RAND xoshiro256ss_rand64
+#define MT19937_UINT xoshiro256ss_uint64
+#define MT19937_SPAN xoshiro256ss_span64
+#define MT19937_REAL xoshiro256ss_real64
+#define MT19937_SHUF xoshiro256ss_shuf64
+#define MT19937_DROP xoshiro256ss_drop64
+#define MT19937_FILL xoshiro256ss_fill64
+#define MT19937_JUMP xoshiro256ss_jump64
+#define MT19937_LONG_JUMP xoshiro256ss_long_jump64
+#define MT19937_JUMP_BY xoshiro256ss_jump_by64
+#define MT19937_NEXT xoshiro256ss_next64
+#define MT19937_STATE_LENGTH 4
+#define XOSHIRO_NEXT(s, result)  \
+{  \
+    result = XOSHIRO_ROTL(s[1] * 5, 7) * 9;  \
+    uint64_t t = s[1] << 17;  \
+    s[2] ^= s[0];  \
+    s[3] ^= s[1];  \
+    s[1] ^= s[2];  \
+    s[0] ^= s[3];  \
+    s[2] ^= t;  \
+    s[3] = XOSHIRO_ROTL(s[3], 45);  \
+}
+#define XOSHIRO_JUMP {0x180EC6D33CFD0ABAU, 0xD5A61266F0C9392CU, 0xA9582618E03FC9AAU, 0x39ABDC4529B1661CU}
+#define XOSHIRO_LONG_JUMP {0x76E15D3EFEFDCBBFU, 0xC5004E441C522FB3U, 0x77710069854EE241U, 0x39109BB02ACBE635U}
+
+// Seeded with 5489.
+static MT19937_OBJECT_TYPE MT19937_OBJECT =
+{
+    {0x47EE8BF6A1AAF709U, 0xC85CE266F96D1180U, 0x0846A1D3E2CCE4EEU, 0x8184716D603FFC25U},
+};
+
+#include "xoshiro_defs.c"
+#include "common_defs.c"
+
+#undef MT19937_WORD
+#undef MT19937_WORD_SIGNED
+#undef MT19937_WORD_WIDTH
+#undef MT19937_WORD_MAX
+#undef MT19937_OBJECT_TYPE
+#undef MT19937_OBJECT
+#undef MT19937_REAL_TYPE
+#undef MT19937_SEED
+#undef MT19937_INIT
+#undef MT19937_RAND
+#undef MT19937_UINT
+#undef MT19937_SPAN
+#undef MT19937_REAL
+#undef MT19937_SHUF
+#undef MT19937_DROP
+#undef MT19937_FILL
+#undef MT19937_JUMP
+#undef MT19937_LONG_JUMP
+#undef MT19937_JUMP_BY
+#undef MT19937_NEXT
+#undef MT19937_STATE_LENGTH
+#undef XOSHIRO_NEXT
+#undef XOSHIRO_JUMP
+#undef XOSHIRO_LONG_JUMP
+
+/******************************************************************************
+ * xoroshiro128+ (the 2018 version, with shifts and rotations 24, 16 and 37).
+ *****************************************************************************/
+#define MT19937_WORD uint64_t
+#define MT19937_WORD_SIGNED int64_t
+#define MT19937_WORD_WIDTH 64
+#define MT19937_WORD_MAX 0xFFFFFFFFFFFFFFFFU
+#define MT19937_OBJECT_TYPE struct xoroshiro128p_64_t
+#define MT19937_OBJECT xoroshiro128p_64
+#define MT19937_REAL_TYPE double long
+#define MT19937_SEED xoroshiro128p_seed64
+#define MT19937_INIT xoroshiro128p_init64
+#define MT19937_RAND xoroshiro128p_rand64
+#define MT19937_UINT xoroshiro128p_uint64
+#define MT19937_SPAN xoroshiro128p_span64
+#define MT19937_REAL xoroshiro128p_real64
+#define MT19937_SHUF xoroshiro128p_shuf64
+#define MT19937_DROP xoroshiro128p_drop64
+#define MT19937_FILL xoroshiro128p_fill64
+#define MT19937_JUMP xoroshiro128p_jump64
+#define MT19937_LONG_JUMP xoroshiro128p_long_jump64
+#define MT19937_JUMP_BY xoroshiro128p_jump_by64
+#define MT19937_NEXT xoroshiro128p_next64
+#define MT19937_STATE_LENGTH 2
+#define XOSHIRO_NEXT(s, result)  \
+{  \
+    uint64_t s0 = s[0];  \
+    uint64_t s1 = s[1];  \
+    result = s0 + s1;  \
+    s1 ^= s0;  \
+    s[0] = XOSHIRO_ROTL(s0, 24) ^ s1 ^ s1 << 16;  \
+    s[1] = XOSHIRO_ROTL(s1, 37);  \
+}
+#define XOSHIRO_JUMP {0xDF900294D8F554A5U, 0x170865DF4B3201FCU}
+#define XOSHIRO_LONG_JUMP {0xD2A98B26625EEE7BU, 0xDDDF9B1090AA7AC1U}
+
+// Seeded with 5489.
+static MT19937_OBJECT_TYPE MT19937_OBJECT =
+{
+    {0x47EE8BF6A1AAF709U, 0xC85CE266F96D1180U},
+};
+
+#include "xoshiro_defs.c"
+#include "common_defs.c"
+
+#undef MT19937_WORD
+#undef MT19937_WORD_SIGNED
+#undef MT19937_WORD_WIDTH
+#undef MT19937_WORD_MAX
+#undef MT19937_OBJECT_TYPE
+#undef MT19937_OBJECT
+#undef MT19937_REAL_TYPE
+#undef MT19937_SEED
+#undef MT19937_INIT
+#undef MT19937_RAND
+#undef MT19937_UINT
+#undef MT19937_SPAN
+#undef MT19937_REAL
+#undef MT19937_SHUF
+#undef MT19937_DROP
+#undef MT19937_FILL
+#undef MT19937_JUMP
+#undef MT19937_LONG_JUMP
+#undef MT19937_JUMP_BY
+#undef MT19937_NEXT
+#undef MT19937_STATE_LENGTH
+#undef XOSHIRO_NEXT
+#undef XOSHIRO_JUMP
+#undef XOSHIRO_LONG_JUMP
+
+/******************************************************************************
+ * PCG64 (a 128-bit linear congruential generator with the XSL-RR output
+ * permutation).
+ *****************************************************************************/
+#define MT19937_WORD uint64_t
+#define MT19937_WORD_SIGNED int64_t
+#define MT19937_WORD_WIDTH 64
+#define MT19937_WORD_MAX 0xFFFFFFFFFFFFFFFFU
+#define MT19937_OBJECT_TYPE struct pcg64_64_t
+#define MT19937_OBJECT pcg64_64
+#define MT19937_REAL_TYPE double long
+#define MT19937_SEED pcg64_seed64
+#define MT19937_SEED_STREAM pcg64_seed_stream64
+#define MT19937_INIT pcg64_init64
+#define MT19937_RAND pcg64_rand64
+#define MT19937_UINT pcg64_uint64
+#define MT19937_SPAN pcg64_span64
+#define MT19937_REAL pcg64_real64
+#define MT19937_SHUF pcg64_shuf64
+#define MT19937_DROP pcg64_drop64
+#define MT19937_FILL pcg64_fill64
+#define MT19937_ADVANCE pcg64_advance64
+#define MT19937_START pcg64_start64
+#define MT19937_MULTIPLY_ADD pcg64_multiply_add64
+#define MT19937_PERMUTE pcg64_permute64
+#define PCG_MULTIPLIER ((uint64_t const[]){0x4385DF649FCCF645U, 0x2360ED051FC65DA4U})
+#define PCG_INCREMENT ((uint64_t const[]){0x14057B7EF767814FU, 0x5851F42D4C957F2DU})
+
+// Seeded with 5489.
+static MT19937_OBJECT_TYPE MT19937_OBJECT =
+{
+    {0x758A66A2922FA30FU, 0xD9ABC9A7E5804304U},
+    {0x14057B7EF767814FU, 0x5851F42D4C957F2DU},
+};
+
+#include "pcg_defs.c"
+#include "common_defs.c"
+
+#undef MT19937_WORD
+#undef MT19937_WORD_SIGNED
+#undef MT19937_WORD_WIDTH
+#undef MT19937_WORD_MAX
+#undef MT19937_OBJECT_TYPE
+#undef MT19937_OBJECT
+#undef MT19937_REAL_TYPE
+#undef MT19937_SEED
+#undef MT19937_SEED_STREAM
+#undef MT19937_INIT
+#undef MT19937_RAND
+#undef MT19937_UINT
+#undef MT19937_SPAN
+#undef MT19937_REAL
+#undef MT19937_SHUF
+#undef MT19937_DROP
+#undef MT19937_FILL
+#undef MT19937_ADVANCE
+#undef MT19937_START
+#undef MT19937_MULTIPLY_ADD
+#undef MT19937_PERMUTE
+#undef PCG_MULTIPLIER
+#undef PCG_INCREMENT
+
+/******************************************************************************
+ * MT521 and MT2203 with parameter sets found by the Dynamic Creator (see
+ * `tools/dcmt`). Objects with different parameter sets generate independent
+ * sequences. They reuse the MT19937 functions, but with the probes and
+ * counters disabled above, so they cannot be mistaken for 32-bit MT19937.
+ *****************************************************************************/
+#include "dcmt_tables.c"
+
+#define MT19937_WORD uint32_t
+#define MT19937_WORD_SIGNED int32_t
+#define MT19937_WORD_WIDTH 32
+#define MT19937_WORD_MAX 0xFFFFFFFFU
+#define MT19937_OBJECT_TYPE struct dcmt521_32_t
+#define MT19937_OBJECT dcmt521_32
+#define MT19937_REAL_TYPE double
+#define MT19937_SEED dcmt521_seed32
+#define MT19937_INIT dcmt521_init32
+#define MT19937_RAND dcmt521_rand32
+#define MT19937_UINT dcmt521_uint32
+#define MT19937_SPAN dcmt521_span32
+#define MT19937_REAL dcmt521_real32
+#define MT19937_SHUF dcmt521_shuf32
+#define MT19937_DROP dcmt521_drop32
+#define MT19937_BACK dcmt521_back32
+#define MT19937_FILL dcmt521_fill32
+#define MT19937_TWIST dcmt521_twist32
+#define MT19937_SELECT dcmt521_select32
+#define MT19937_STATE_LENGTH 17
+#define MT19937_STATE_MIDDLE 8
+#define MT19937_MASK_UPPER 0xFF800000U
+#define MT19937_MASK_LOWER 0x007FFFFFU
+#define MT19937_MASK_TWIST (mt->twist)
+#define MT19937_MULTIPLIER 0x6C078965U
+#define MT19937_TEMPER_B 0x9D2C5680U
+#define MT19937_TEMPER_C 0xEFC60000U
+#define MT19937_TEMPER_D 0xFFFFFFFFU
+#define MT19937_TEMPER_I 18
+#define MT19937_TEMPER_S 7
+#define MT19937_TEMPER_T 15
+#define MT19937_TEMPER_U 11
+#define DCMT_TWISTS dcmt521_twists
+
+// Seeded with 5489, using the first parameter set.
+static MT19937_OBJECT_TYPE MT19937_OBJECT =
+{
+    {
+        0x00001571U, 0x4D98EE96U, 0xAF25F095U, 0xAFD9BA96U, 0x6FCBD068U, 0x2CD06A72U, 0x384F0100U, 0x85B46507U,
+        0x295E8801U, 0x0D1B316EU, 0x7B305E70U, 0xBDB6BBA0U, 0x1CEFB8F6U, 0x8B499F1BU, 0x3FDF25EBU, 0xCBC1B8C6U,
+        0x38B252C9U,
+    },
+    {0},
+    MT19937_STATE_LENGTH,
+    0x9E760000U,
+};
+
+#include "mt19937_defs.c"
+#include "dcmt_defs.c"
+#include "common_defs.c"
+
+#undef MT19937_WORD
+#undef MT19937_WORD_SIGNED
+#undef MT19937_WORD_WIDTH
+#undef MT19937_WORD_MAX
+#undef MT19937_OBJECT_TYPE
+#undef MT19937_OBJECT
+#undef MT19937_REAL_TYPE
+#undef MT19937_SEED
+#undef MT19937_INIT
+#undef MT19937_RAND
+#undef MT19937_UINT
+#undef MT19937_SPAN
+#undef MT19937_REAL
+#undef MT19937_SHUF
+#undef MT19937_DROP
+#undef MT19937_BACK
+#undef MT19937_FILL
+#undef MT19937_TWIST
+#undef MT19937_SELECT
+#undef MT19937_STATE_LENGTH
+#undef MT19937_STATE_MIDDLE
+#undef MT19937_MASK_UPPER
+#undef MT19937_MASK_LOWER
+#undef MT19937_MASK_TWIST
+#undef MT19937_MULTIPLIER
+#undef MT19937_TEMPER_B
+#undef MT19937_TEMPER_C
+#undef MT19937_TEMPER_D
+#undef MT19937_TEMPER_I
+#undef MT19937_TEMPER_S
+#undef MT19937_TEMPER_T
+#undef MT19937_TEMPER_U
+#undef DCMT_TWISTS
+
+#define MT19937_WORD uint32_t
+#define MT19937_WORD_SIGNED int32_t
+#define MT19937_WORD_WIDTH 32
+#define MT19937_WORD_MAX 0xFFFFFFFFU
+#define MT19937_OBJECT_TYPE struct dcmt2203_32_t
+#define MT19937_OBJECT dcmt2203_32
+#define MT19937_REAL_TYPE double
+#define MT19937_SEED dcmt2203_seed32
+#define MT19937_INIT dcmt2203_init32
+#define MT19937_RAND dcmt2203_rand32
+#define MT19937_UINT dcmt2203_uint32
+#define MT19937_SPAN dcmt2203_span32
+#define MT19937_REAL dcmt2203_real32
+#define MT19937_SHUF dcmt2203_shuf32
+#define MT19937_DROP dcmt2203_drop32
+#define MT19937_BACK dcmt2203_back32
+#define MT19937_FILL dcmt2203_fill32
+#define MT19937_TWIST dcmt2203_twist32
+#define MT19937_SELECT dcmt2203_select32
+#define MT19937_STATE_LENGTH 69
+#define MT19937_STATE_MIDDLE 34
+#define MT19937_MASK_UPPER 0xFFFFFFE0U
+#define MT19937_MASK_LOWER 0x0000001FU
+#define MT19937_MASK_TWIST (mt->twist)
+#define MT19937_MULTIPLIER 0x6C078965U
+#define MT19937_TEMPER_B 0x9D2C5680U
+#define MT19937_TEMPER_C 0xEFC60000U
+#define MT19937_TEMPER_D 0xFFFFFFFFU
+#define MT19937_TEMPER_I 18
+#define MT19937_TEMPER_S 7
+#define MT19937_TEMPER_T 15
+#define MT19937_TEMPER_U 11
+#define DCMT_TWISTS dcmt2203_twists
+
+// Seeded with 5489, using the first parameter set.
+static MT19937_OBJECT_TYPE MT19937_OBJECT =
+{
+    {
+        0x00001571U, 0x4D98EE96U, 0xAF25F095U, 0xAFD9BA96U, 0x6FCBD068U, 0x2CD06A72U, 0x384F0100U, 0x85B46507U,
+        0x295E8801U, 0x0D1B316EU, 0x7B305E70U, 0xBDB6BBA0U, 0x1CEFB8F6U, 0x8B499F1BU, 0x3FDF25EBU, 0xCBC1B8C6U,
+        0x38B252C9U, 0xDC273A5EU, 0xAE40CBC3U, 0x6AE1AC38U, 0xB1C27391U, 0x5E964414U, 0x744B195FU, 0x6BC6502DU,
+        0x67592D74U, 0x19B58C42U, 0xFA7DA824U, 0x1FA1367EU, 0x6635EDD2U, 0xB451BF5CU, 0xC73BCE34U, 0x7374CAD2U,
+        0x9D63F05FU, 0x629A99D2U, 0xDC159B61U, 0xFC5BBFCDU, 0xD079EA6AU, 0x336AAC92U, 0xAF6E37C0U, 0x90A0D1B1U,
+        0x5F9086C7U, 0x438F2247U, 0xB8B9FBC8U, 0x83A570DDU, 0xA3C5DF27U, 0x377ED6C6U, 0x2D64B24CU, 0xBC39042BU,
+        0x2ED7955DU, 0x2B87B2E2U, 0x0772855CU, 0xAF10D97FU, 0xC474B385U, 0x66C78A13U, 0xB41B1B50U, 0xE78EA991U,
+        0xEF0608D2U, 0xF1D053AEU, 0x29B3987BU, 0x9FD1FBC2U, 0x4FD212FCU, 0x2AF5E30EU, 0xA6E712C4U, 0x8DA05E5DU,
+        0x5B5F12BBU, 0xE89DEDA3U, 0x49D96062U, 0xDE0D0252U, 0xCD964339U,
+    },
+    {0},
+    MT19937_STATE_LENGTH,
+    0xC1D70000U,
 };
 
 #include "mt19937_defs.c"
+#include "dcmt_defs.c"
+#include "common_defs.c"
 
 #undef MT19937_WORD
 #undef MT19937_WORD_SIGNED
@@ -315,6 +888,10 @@ static MT19937_OBJECT_TYPE MT19937_OBJECT =
 #undef MT19937_REAL
 #undef MT19937_SHUF
 #undef MT19937_DROP
+#undef MT19937_BACK
+#undef MT19937_FILL
+#undef MT19937_TWIST
+#undef MT19937_SELECT
 #undef MT19937_STATE_LENGTH
 #undef MT19937_STATE_MIDDLE
 #undef MT19937_MASK_UPPER
@@ -328,3 +905,4 @@ static MT19937_OBJECT_TYPE MT19937_OBJECT =
 #undef MT19937_TEMPER_S
 #undef MT19937_TEMPER_T
 #undef MT19937_TEMPER_U
+#undef DCMT_TWISTS
@@ -1,6 +1,14 @@
 MT19937_WORD MT19937_SEED(MT19937_WORD seed, MT19937_OBJECT_TYPE *mt)
 {
+    // Objects are not initialised in C, so their counters are reset here. (If
+    // `mt` is `NULL`, the counters of the calling thread are reset.)
+#if defined MT19937_STATS && defined MT19937_STATS_OBJECT
+    MT19937_STATS_RESET(mt);
+#endif
+    MT19937_STATS_SELECT(mt)
+    MT19937_STATS_COUNT(seed, 1);
     mt = mt == NULL ? &MT19937_OBJECT : mt;
+    MT19937_PROBE3(seed, MT19937_WORD_WIDTH, mt, seed);
     mt->state[0] = seed;
     for(int i = 1; i < MT19937_STATE_LENGTH; ++i)
     {
@@ -21,7 +29,11 @@ MT19937_WORD MT19937_INIT(MT19937_OBJECT_TYPE *mt)
     thrd_t id = thrd_current();
     seed += djb2t(&id, sizeof id);
 #endif
-    return MT19937_SEED(seed, mt);
+    MT19937_PROBE3(init, MT19937_WORD_WIDTH, mt == NULL ? &MT19937_OBJECT : mt, seed);
+    MT19937_WORD seed_ = MT19937_SEED(seed, mt);
+    MT19937_STATS_SELECT(mt)
+    MT19937_STATS_COUNT(init, 1);
+    return seed_;
 }
 
 
@@ -57,93 +69,186 @@ MT19937_WORD twisted = combo >> 1 ^ (mask & MT19937_MASK_TWIST);  \
 mt->state[i] = mt->state[k] ^ twisted;
 #endif
 
+/******************************************************************************
+ * Temper the state of MT19937, storing the results in `value`.
+ *****************************************************************************/
+#ifndef MT19937_TEMPER_LOOP
+#define MT19937_TEMPER_LOOP  \
+for(int i = 0; i < MT19937_STATE_LENGTH; ++i)  \
+{  \
+    MT19937_WORD curr = mt->state[i];  \
+    curr ^= curr >> MT19937_TEMPER_U & MT19937_TEMPER_D;  \
+    curr ^= curr << MT19937_TEMPER_S & MT19937_TEMPER_B;  \
+    curr ^= curr << MT19937_TEMPER_T & MT19937_TEMPER_C;  \
+    curr ^= curr >> MT19937_TEMPER_I;  \
+    mt->value[i] = curr;  \
+}
+#endif
+
+/******************************************************************************
+ * Twist the state of MT19937 and temper it, storing the results in `value`.
+ *
+ * This is inlined into each function which generates numbers, so that it is
+ * compiled for the instruction set each of their clones targets.
+ *
+ * @param mt MT19937 object (not `NULL`).
+ *****************************************************************************/
+MT19937_ALWAYS_INLINE
+static inline void MT19937_TWIST(MT19937_OBJECT_TYPE *mt)
+{
+    MT19937_PROBE2(twist_start, MT19937_WORD_WIDTH, mt);
+
+    // Twist.
+    mt->index = 0;
+    for(int i = 0; i < MT19937_STATE_LENGTH - MT19937_STATE_MIDDLE; ++i)
+    {
+        MT19937_TWIST_LOOP_BODY(i, i + 1, i + MT19937_STATE_MIDDLE)
+    }
+    for(int i = MT19937_STATE_LENGTH - MT19937_STATE_MIDDLE; i < MT19937_STATE_LENGTH - 1; ++i)
+    {
+        MT19937_TWIST_LOOP_BODY(i, i + 1, i + MT19937_STATE_MIDDLE - MT19937_STATE_LENGTH)
+    }
+    MT19937_TWIST_LOOP_BODY(MT19937_STATE_LENGTH - 1, 0, MT19937_STATE_MIDDLE - 1)
+
+    // Generate.
+    MT19937_TEMPER_LOOP
+
+    MT19937_PROBE2(twist_end, MT19937_WORD_WIDTH, mt);
+}
+
+
+MT19937_CLONES
 MT19937_WORD MT19937_RAND(MT19937_OBJECT_TYPE *mt)
 {
+    MT19937_STATS_SELECT(mt)
+    MT19937_STATS_COUNT(rand, 1);
     mt = mt == NULL ? &MT19937_OBJECT : mt;
     if(mt->index == MT19937_STATE_LENGTH)
     {
-        // Twist.
-        mt->index = 0;
-        for(int i = 0; i < MT19937_STATE_LENGTH - MT19937_STATE_MIDDLE; ++i)
-        {
-            MT19937_TWIST_LOOP_BODY(i, i + 1, i + MT19937_STATE_MIDDLE)
-        }
-        for(int i = MT19937_STATE_LENGTH - MT19937_STATE_MIDDLE; i < MT19937_STATE_LENGTH - 1; ++i)
-        {
-            MT19937_TWIST_LOOP_BODY(i, i + 1, i + MT19937_STATE_MIDDLE - MT19937_STATE_LENGTH)
-        }
-        MT19937_TWIST_LOOP_BODY(MT19937_STATE_LENGTH - 1, 0, MT19937_STATE_MIDDLE - 1)
-
-        // Generate.
-        for(int i = 0; i < MT19937_STATE_LENGTH; ++i)
-        {
-            MT19937_WORD curr = mt->state[i];
-            curr ^= curr >> MT19937_TEMPER_U & MT19937_TEMPER_D;
-            curr ^= curr << MT19937_TEMPER_S & MT19937_TEMPER_B;
-            curr ^= curr << MT19937_TEMPER_T & MT19937_TEMPER_C;
-            curr ^= curr >> MT19937_TEMPER_I;
-            mt->value[i] = curr;
-        }
+        MT19937_STATS_COUNT(twists, 1);
+        MT19937_TWIST(mt);
     }
     return mt->value[mt->index++];
 }
 
 
-MT19937_WORD MT19937_UINT(MT19937_WORD modulus, MT19937_OBJECT_TYPE *mt)
+MT19937_CLONES
+void MT19937_FILL(MT19937_WORD *items, size_t num_of_items, MT19937_OBJECT_TYPE *mt)
 {
-    MT19937_WORD upper = MT19937_WORD_MAX - MT19937_WORD_MAX % modulus;
-    MT19937_WORD r;
-    do
+    MT19937_STATS_SELECT(mt)
+    MT19937_STATS_COUNT(fill, 1);
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    while(num_of_items > 0)
     {
-        r = MT19937_RAND(mt);
+        if(mt->index == MT19937_STATE_LENGTH)
+        {
+            MT19937_STATS_COUNT(twists, 1);
+            MT19937_TWIST(mt);
+        }
+        size_t count = MT19937_STATE_LENGTH - mt->index;
+        count = count < num_of_items ? count : num_of_items;
+        memcpy(items, mt->value + mt->index, count * sizeof *items);
+        items += count;
+        num_of_items -= count;
+        mt->index += count;
     }
-    while(r >= upper);
-    return r % modulus;
 }
 
 
-MT19937_WORD_SIGNED MT19937_SPAN(MT19937_WORD_SIGNED left, MT19937_WORD_SIGNED right, MT19937_OBJECT_TYPE *mt)
+void MT19937_DROP(int long long count, MT19937_OBJECT_TYPE *mt)
 {
-    // Signed exact-width integer types are required to use two's complement
-    // representation. This code will always work.
-    MT19937_WORD uleft = (MT19937_WORD)left;
-    MT19937_WORD uright = (MT19937_WORD)right;
-    MT19937_WORD modulus = uright - uleft;
-    MT19937_WORD r = MT19937_UINT(modulus, mt);
-    return (MT19937_WORD_SIGNED)(r + uleft);
+    MT19937_STATS_SELECT(mt)
+    MT19937_STATS_COUNT(drop, 1);
+    MT19937_STATS_COUNT(drop_steps, count > 0 ? count : 0);
+    while(count-- > 0)
+    {
+        MT19937_RAND(mt);
+    }
 }
 
 
-MT19937_REAL_TYPE MT19937_REAL(MT19937_OBJECT_TYPE *mt)
-{
-    return (MT19937_REAL_TYPE)MT19937_RAND(mt) / MT19937_WORD_MAX;
-}
 
+/******************************************************************************
+ * Recover the combination of the upper bits of one word and the lower bits of
+ * the next from the result of twisting it. Since the MSB of
+ * `MT19937_MASK_TWIST` is set and that of the shifted combination is not, the
+ * MSB of `twisted` tells whether the combination was odd.
+ *****************************************************************************/
+#ifndef MT19937_UNTWIST_COMBO
+#define MT19937_UNTWIST_COMBO(twisted)  \
+(((twisted) ^ (-((twisted) >> (MT19937_WORD_WIDTH - 1)) & MT19937_MASK_TWIST)) << 1  \
+ | (twisted) >> (MT19937_WORD_WIDTH - 1))
+#endif
 
-void MT19937_SHUF(void *items, MT19937_WORD num_of_items, size_t size_of_item, MT19937_OBJECT_TYPE *mt)
+void MT19937_BACK(int long long count, MT19937_OBJECT_TYPE *mt)
 {
-    char unsigned *tmp = malloc(size_of_item);
-    char unsigned *items_ = items;
-    for(MT19937_WORD i = num_of_items - 1; i > 0; --i)
+    MT19937_STATS_SELECT(mt)
+    MT19937_STATS_COUNT(back, 1);
+    MT19937_STATS_COUNT(back_steps, count > 0 ? count : 0);
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    if(count <= 0)
+    {
+        return;
+    }
+
+    // If all numbers generated from the state have been used (or none have
+    // been generated, because it was just seeded), `value` may not match the
+    // state, so it has to be recomputed even if no twist is undone.
+    if(count <= mt->index && mt->index < MT19937_STATE_LENGTH)
+    {
+        mt->index -= count;
+        return;
+    }
+
+    // Undo as many twists as required (possibly none). Word `i` was twisted
+    // using the old words `i` and `i + 1` and the word
+    // `i + MT19937_STATE_MIDDLE` (which is old only if it was not twisted
+    // before word `i`). Hence, restoring the words from last to first, the new
+    // and old words needed are both available. Word 0 is restored using the
+    // last combination of the previous twist. The arithmetic cannot overflow,
+    // even if `count` is close to `LLONG_MAX`.
+    int long long twists = 0;
+    int index;
+    if(count > mt->index)
+    {
+        int long long excess = count - mt->index - 1;
+        twists = excess / MT19937_STATE_LENGTH + 1;
+        index = MT19937_STATE_LENGTH - 1 - excess % MT19937_STATE_LENGTH;
+    }
+    else
     {
-        MT19937_WORD j = MT19937_UINT(i + 1, mt);
-        if(i != j)
+        index = mt->index - count;
+    }
+    for(int long long t = 0; t < twists; ++t)
+    {
+        MT19937_WORD twisted = mt->state[MT19937_STATE_LENGTH - 1] ^ mt->state[MT19937_STATE_MIDDLE - 1];
+        MT19937_WORD combo = MT19937_UNTWIST_COMBO(twisted);
+        for(int i = MT19937_STATE_LENGTH - 1; i >= 0; --i)
         {
-            char unsigned *items_i = items_ + i * size_of_item;
-            char unsigned *items_j = items_ + j * size_of_item;
-            memcpy(tmp, items_i, size_of_item);
-            memcpy(items_i, items_j, size_of_item);
-            memcpy(items_j, tmp, size_of_item);
+            int prev = (i + MT19937_STATE_LENGTH - 1) % MT19937_STATE_LENGTH;
+            int prev_middle = (i + MT19937_STATE_MIDDLE - 1) % MT19937_STATE_LENGTH;
+            MT19937_WORD prev_twisted = mt->state[prev] ^ mt->state[prev_middle];
+            MT19937_WORD prev_combo = MT19937_UNTWIST_COMBO(prev_twisted);
+            mt->state[i] = (MT19937_MASK_UPPER & combo) | (MT19937_MASK_LOWER & prev_combo);
+            combo = prev_combo;
         }
     }
-    free(tmp);
+    mt->index = index;
+    MT19937_TEMPER_LOOP
 }
 
+// Generators which reuse these functions without counters of their own leave
+// `MT19937_STATS_OBJECT` undefined.
+#if defined MT19937_STATS && defined MT19937_STATS_OBJECT
+struct mt19937_stats_t MT19937_STATS_GET(MT19937_OBJECT_TYPE const *mt)
+{
+    return mt == NULL ? MT19937_STATS_OBJECT : mt->stats;
+}
 
-void MT19937_DROP(int long long count, MT19937_OBJECT_TYPE *mt)
+
+void MT19937_STATS_RESET(MT19937_OBJECT_TYPE *mt)
 {
-    while(count-- > 0)
-    {
-        MT19937_RAND(mt);
-    }
+    struct mt19937_stats_t zero = {0};
+    *(mt == NULL ? &MT19937_STATS_OBJECT : &mt->stats) = zero;
 }
+#endif
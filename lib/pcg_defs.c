@@ -0,0 +1,171 @@
+/******************************************************************************
+ * Multiply two 128-bit numbers and add a third one to the product. Each
+ * number is stored in two words, the first of which is the least significant.
+ * If the compiler has a 128-bit integer type, it is used; otherwise, the
+ * product of the least significant words is calculated from 32-bit halves.
+ *
+ * @param a Multiplicand.
+ * @param b Multiplier.
+ * @param c Addend.
+ * @param result Array to store the result in. May be any of the above.
+ *****************************************************************************/
+static inline void MT19937_MULTIPLY_ADD(
+    uint64_t const a[2], uint64_t const b[2], uint64_t const c[2], uint64_t result[2]
+)
+{
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef unsigned __int128 uint128_t;
+    uint128_t a_ = (uint128_t)a[1] << 64 | a[0];
+    uint128_t b_ = (uint128_t)b[1] << 64 | b[0];
+    uint128_t c_ = (uint128_t)c[1] << 64 | c[0];
+    uint128_t result_ = a_ * b_ + c_;
+    result[0] = (uint64_t)result_;
+    result[1] = (uint64_t)(result_ >> 64);
+#else
+    uint64_t a0 = a[0] & 0xFFFFFFFFU, a1 = a[0] >> 32;
+    uint64_t b0 = b[0] & 0xFFFFFFFFU, b1 = b[0] >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t middle = (p00 >> 32) + (p01 & 0xFFFFFFFFU) + (p10 & 0xFFFFFFFFU);
+    uint64_t low = (p00 & 0xFFFFFFFFU) | middle << 32;
+    uint64_t high = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32) + a[0] * b[1] + a[1] * b[0];
+    low += c[0];
+    high += c[1] + (low < c[0]);
+    result[0] = low;
+    result[1] = high;
+#endif
+}
+
+
+/******************************************************************************
+ * Calculate the output of the XSL-RR permutation: XOR the two halves of the
+ * state, and rotate the result by its six most significant bits.
+ *
+ * @param state State.
+ *
+ * @return Pseudorandom number.
+ *****************************************************************************/
+static inline uint64_t MT19937_PERMUTE(uint64_t const state[2])
+{
+    uint64_t folded = state[1] ^ state[0];
+    int rotation = state[1] >> 58;
+    return folded >> rotation | folded << (-rotation & 63);
+}
+
+
+/******************************************************************************
+ * Start the sequence of an object whose increment has been set, in the same
+ * way as the reference implementation does.
+ *
+ * @param seed Seed.
+ * @param mt Object.
+ *****************************************************************************/
+static inline void MT19937_START(uint64_t seed, MT19937_OBJECT_TYPE *mt)
+{
+    uint64_t const seed_[2] = {seed, 0};
+    uint64_t const one[2] = {1, 0};
+    MT19937_MULTIPLY_ADD(seed_, one, mt->increment, mt->state);
+    MT19937_MULTIPLY_ADD(mt->state, PCG_MULTIPLIER, mt->increment, mt->state);
+}
+
+
+uint64_t MT19937_SEED(uint64_t seed, MT19937_OBJECT_TYPE *mt)
+{
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    mt->increment[0] = PCG_INCREMENT[0];
+    mt->increment[1] = PCG_INCREMENT[1];
+    MT19937_START(seed, mt);
+    return seed;
+}
+
+
+uint64_t MT19937_SEED_STREAM(uint64_t seed, uint64_t stream, MT19937_OBJECT_TYPE *mt)
+{
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+
+    // The increment must be odd.
+    mt->increment[0] = stream << 1 | 1;
+    mt->increment[1] = stream >> 63;
+    MT19937_START(seed, mt);
+    return seed;
+}
+
+
+uint64_t MT19937_INIT(MT19937_OBJECT_TYPE *mt)
+{
+    time_t now = time(NULL);
+    int long long unsigned seed = djb2t(&now, sizeof now) + (uintptr_t)&mt;
+#ifndef __STDC_NO_THREADS__
+    thrd_t id = thrd_current();
+    seed += djb2t(&id, sizeof id);
+#endif
+    return MT19937_SEED(seed, mt);
+}
+
+
+MT19937_WORD MT19937_RAND(MT19937_OBJECT_TYPE *mt)
+{
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    MT19937_MULTIPLY_ADD(mt->state, PCG_MULTIPLIER, mt->increment, mt->state);
+    return MT19937_PERMUTE(mt->state);
+}
+
+
+// Each number depends on the previous state, so there is nothing to vectorise.
+void MT19937_FILL(MT19937_WORD *items, size_t num_of_items, MT19937_OBJECT_TYPE *mt)
+{
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    uint64_t state[2] = {mt->state[0], mt->state[1]};
+    uint64_t const increment[2] = {mt->increment[0], mt->increment[1]};
+    for(size_t i = 0; i < num_of_items; ++i)
+    {
+        MT19937_MULTIPLY_ADD(state, PCG_MULTIPLIER, increment, state);
+        items[i] = MT19937_PERMUTE(state);
+    }
+    mt->state[0] = state[0];
+    mt->state[1] = state[1];
+}
+
+
+/******************************************************************************
+ * Advancing the state by `delta` steps amounts to applying the affine map
+ * `x -> multiplier * x + increment` `delta` times. The composition of such maps
+ * is another such map, so the map for `delta` steps is assembled from the maps
+ * for powers of two steps by squaring, as in Brown's "Random Number Generation
+ * with Arbitrary Strides". The period is 2 ** 128, so going back by `n` steps
+ * is the same as advancing by 2 ** 128 - `n` steps.
+ *****************************************************************************/
+void MT19937_ADVANCE(int64_t delta, MT19937_OBJECT_TYPE *mt)
+{
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    uint64_t steps[2] = {(uint64_t)delta, delta < 0 ? 0xFFFFFFFFFFFFFFFFU : 0};
+    uint64_t multiplier[2] = {PCG_MULTIPLIER[0], PCG_MULTIPLIER[1]};
+    uint64_t increment[2] = {mt->increment[0], mt->increment[1]};
+    uint64_t accumulated_multiplier[2] = {1, 0};
+    uint64_t accumulated_increment[2] = {0, 0};
+    uint64_t const one[2] = {1, 0};
+    uint64_t const zero[2] = {0, 0};
+    while(steps[0] > 0 || steps[1] > 0)
+    {
+        if(steps[0] & 1)
+        {
+            MT19937_MULTIPLY_ADD(accumulated_multiplier, multiplier, zero, accumulated_multiplier);
+            MT19937_MULTIPLY_ADD(accumulated_increment, multiplier, increment, accumulated_increment);
+        }
+        uint64_t multiplier_plus_one[2];
+        MT19937_MULTIPLY_ADD(multiplier, one, one, multiplier_plus_one);
+        MT19937_MULTIPLY_ADD(multiplier_plus_one, increment, zero, increment);
+        MT19937_MULTIPLY_ADD(multiplier, multiplier, zero, multiplier);
+        steps[0] = steps[0] >> 1 | steps[1] << 63;
+        steps[1] >>= 1;
+    }
+    MT19937_MULTIPLY_ADD(accumulated_multiplier, mt->state, accumulated_increment, mt->state);
+}
+
+
+void MT19937_DROP(int long long count, MT19937_OBJECT_TYPE *mt)
+{
+    if(count > 0)
+    {
+        MT19937_ADVANCE(count, mt);
+    }
+}
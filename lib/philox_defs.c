@@ -0,0 +1,200 @@
+/******************************************************************************
+ * Execute one round of Philox4x32: multiply two words of the counter, and mix
+ * the halves of the products with the other two words and the key.
+ *****************************************************************************/
+#ifndef PHILOX_ROUND
+#define PHILOX_ROUND(c0, c1, c2, c3, k0, k1)  \
+{  \
+    int long long unsigned product0 = (int long long unsigned)PHILOX_MULTIPLIER_0 * c0;  \
+    int long long unsigned product1 = (int long long unsigned)PHILOX_MULTIPLIER_1 * c2;  \
+    c0 = (uint32_t)(product1 >> 32) ^ c1 ^ k0;  \
+    c1 = (uint32_t)product1;  \
+    c2 = (uint32_t)(product0 >> 32) ^ c3 ^ k1;  \
+    c3 = (uint32_t)product0;  \
+}
+#endif
+
+/******************************************************************************
+ * Transform a counter into four pseudorandom words. The key is bumped by a
+ * Weyl sequence between rounds.
+ *
+ * @param counter Counter (the first word is the least significant).
+ * @param key Key (the first word is the least significant).
+ * @param value Array to store the results in.
+ *****************************************************************************/
+static inline void MT19937_BIJECT(uint32_t const counter[4], uint32_t const key[2], uint32_t value[4])
+{
+    uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+    uint32_t k0 = key[0], k1 = key[1];
+    for(int i = 0; i < PHILOX_ROUNDS; ++i)
+    {
+        PHILOX_ROUND(c0, c1, c2, c3, k0, k1)
+        k0 += PHILOX_WEYL_0;
+        k1 += PHILOX_WEYL_1;
+    }
+    value[0] = c0;
+    value[1] = c1;
+    value[2] = c2;
+    value[3] = c3;
+}
+
+
+/******************************************************************************
+ * Add a number to a counter.
+ *
+ * @param counter Counter (the first word is the least significant).
+ * @param steps Number to add.
+ *****************************************************************************/
+static inline void MT19937_ADVANCE(uint32_t counter[4], int long long unsigned steps)
+{
+    for(int i = 0; i < 4 && steps > 0; ++i)
+    {
+        int long long unsigned sum = counter[i] + (steps & 0xFFFFFFFFU);
+        counter[i] = (uint32_t)sum;
+        steps = (steps >> 32) + (sum >> 32);
+    }
+}
+
+
+uint64_t MT19937_SEED(uint64_t seed, MT19937_OBJECT_TYPE *mt)
+{
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    mt->key[0] = (uint32_t)seed;
+    mt->key[1] = (uint32_t)(seed >> 32);
+    mt->counter[0] = mt->counter[1] = mt->counter[2] = mt->counter[3] = 0;
+    MT19937_BIJECT(mt->counter, mt->key, mt->value);
+    mt->index = 0;
+    return seed;
+}
+
+
+uint64_t MT19937_INIT(MT19937_OBJECT_TYPE *mt)
+{
+    time_t now = time(NULL);
+    int long long unsigned seed = djb2t(&now, sizeof now) + (uintptr_t)&mt;
+#ifndef __STDC_NO_THREADS__
+    thrd_t id = thrd_current();
+    seed += djb2t(&id, sizeof id);
+#endif
+    return MT19937_SEED(seed, mt);
+}
+
+
+MT19937_WORD MT19937_RAND(MT19937_OBJECT_TYPE *mt)
+{
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    if(mt->index == 4)
+    {
+        MT19937_ADVANCE(mt->counter, 1);
+        MT19937_BIJECT(mt->counter, mt->key, mt->value);
+        mt->index = 0;
+    }
+    return mt->value[mt->index++];
+}
+
+
+MT19937_CLONES
+void MT19937_FILL(MT19937_WORD *items, size_t num_of_items, MT19937_OBJECT_TYPE *mt)
+{
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    while(num_of_items > 0 && mt->index < 4)
+    {
+        *items++ = mt->value[mt->index++];
+        --num_of_items;
+    }
+
+    // Transform several consecutive counters at a time. The rounds are
+    // independent of one another, so they can be vectorised.
+    while(num_of_items >= 4 * PHILOX_LANES)
+    {
+        uint32_t c0[PHILOX_LANES], c1[PHILOX_LANES], c2[PHILOX_LANES], c3[PHILOX_LANES];
+        if(mt->counter[0] <= 0xFFFFFFFFU - PHILOX_LANES)
+        {
+            // Usually, only the least significant word changes.
+            for(int i = 0; i < PHILOX_LANES; ++i)
+            {
+                c0[i] = mt->counter[0] + 1 + i;
+                c1[i] = mt->counter[1];
+                c2[i] = mt->counter[2];
+                c3[i] = mt->counter[3];
+            }
+            mt->counter[0] += PHILOX_LANES;
+        }
+        else
+        {
+            for(int i = 0; i < PHILOX_LANES; ++i)
+            {
+                MT19937_ADVANCE(mt->counter, 1);
+                c0[i] = mt->counter[0];
+                c1[i] = mt->counter[1];
+                c2[i] = mt->counter[2];
+                c3[i] = mt->counter[3];
+            }
+        }
+        uint32_t k0[PHILOX_ROUNDS], k1[PHILOX_ROUNDS];
+        k0[0] = mt->key[0];
+        k1[0] = mt->key[1];
+        for(int i = 1; i < PHILOX_ROUNDS; ++i)
+        {
+            k0[i] = k0[i - 1] + PHILOX_WEYL_0;
+            k1[i] = k1[i - 1] + PHILOX_WEYL_1;
+        }
+        for(int i = 0; i < PHILOX_LANES; ++i)
+        {
+            for(int j = 0; j < PHILOX_ROUNDS; ++j)
+            {
+                PHILOX_ROUND(c0[i], c1[i], c2[i], c3[i], k0[j], k1[j])
+            }
+        }
+        for(int i = 0; i < PHILOX_LANES; ++i)
+        {
+            items[4 * i] = c0[i];
+            items[4 * i + 1] = c1[i];
+            items[4 * i + 2] = c2[i];
+            items[4 * i + 3] = c3[i];
+        }
+        items += 4 * PHILOX_LANES;
+        num_of_items -= 4 * PHILOX_LANES;
+
+        // The last block generated is now the current one, and it has been
+        // used up.
+        mt->value[0] = c0[PHILOX_LANES - 1];
+        mt->value[1] = c1[PHILOX_LANES - 1];
+        mt->value[2] = c2[PHILOX_LANES - 1];
+        mt->value[3] = c3[PHILOX_LANES - 1];
+        mt->index = 4;
+    }
+
+    while(num_of_items-- > 0)
+    {
+        *items++ = MT19937_RAND(mt);
+    }
+}
+
+
+void MT19937_SEEK(uint64_t position, MT19937_OBJECT_TYPE *mt)
+{
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    mt->counter[0] = (uint32_t)(position >> 2);
+    mt->counter[1] = (uint32_t)(position >> 34);
+    mt->counter[2] = mt->counter[3] = 0;
+    MT19937_BIJECT(mt->counter, mt->key, mt->value);
+    mt->index = position & 3;
+}
+
+
+void MT19937_DROP(int long long count, MT19937_OBJECT_TYPE *mt)
+{
+    if(count <= 0)
+    {
+        return;
+    }
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    int long long unsigned steps = (int long long unsigned)count + mt->index;
+    if(steps >= 4)
+    {
+        MT19937_ADVANCE(mt->counter, steps / 4);
+        MT19937_BIJECT(mt->counter, mt->key, mt->value);
+    }
+    mt->index = steps % 4;
+}
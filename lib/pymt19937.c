@@ -193,6 +193,147 @@ drop64(PyObject *self, PyObject *args)
 }
 
 
+static PyObject *
+back32(PyObject *self, PyObject *args)
+{
+    int long long count;
+    if(!PyArg_ParseTuple(args, "L", &count))
+    {
+        return NULL;
+    }
+    mt19937_back32(count, NULL);
+    Py_RETURN_NONE;
+}
+
+
+static PyObject *
+back64(PyObject *self, PyObject *args)
+{
+    int long long count;
+    if(!PyArg_ParseTuple(args, "L", &count))
+    {
+        return NULL;
+    }
+    mt19937_back64(count, NULL);
+    Py_RETURN_NONE;
+}
+
+
+static PyObject *
+pcg64_seed(PyObject *self, PyObject *args)
+{
+    int long long unsigned seed, stream;
+    if(!PyArg_ParseTuple(args, "K|K", &seed, &stream))
+    {
+        return NULL;
+    }
+    seed = PyLong_AsUnsignedLongLong(PyTuple_GET_ITEM(args, 0));
+    if(PyErr_Occurred() != NULL || seed > UINT64_MAX)
+    {
+        return PyErr_Format(PyExc_ValueError, "argument 1 must be an integer in [0, %llu]", UINT64_MAX);
+    }
+    if(PyTuple_GET_SIZE(args) == 1)
+    {
+        return PyLong_FromUnsignedLongLong(pcg64_seed64(seed, NULL));
+    }
+    stream = PyLong_AsUnsignedLongLong(PyTuple_GET_ITEM(args, 1));
+    if(PyErr_Occurred() != NULL || stream > UINT64_MAX)
+    {
+        return PyErr_Format(PyExc_ValueError, "argument 2 must be an integer in [0, %llu]", UINT64_MAX);
+    }
+    return PyLong_FromUnsignedLongLong(pcg64_seed_stream64(seed, stream, NULL));
+}
+
+
+static PyObject *
+pcg64_init(PyObject *self, PyObject *args)
+{
+    return PyLong_FromUnsignedLongLong(pcg64_init64(NULL));
+}
+
+
+static PyObject *
+pcg64_rand(PyObject *self, PyObject *args)
+{
+    return PyLong_FromUnsignedLongLong(pcg64_rand64(NULL));
+}
+
+
+static PyObject *
+pcg64_uint(PyObject *self, PyObject *args)
+{
+    int long long unsigned modulus;
+    if(!PyArg_ParseTuple(args, "K", &modulus))
+    {
+        return NULL;
+    }
+    modulus = PyLong_AsUnsignedLongLong(PyTuple_GET_ITEM(args, 0));
+    if(PyErr_Occurred() != NULL || modulus == 0 || modulus > UINT64_MAX)
+    {
+        return PyErr_Format(PyExc_ValueError, "argument 1 must be an integer in [1, %llu]", UINT64_MAX);
+    }
+    return PyLong_FromUnsignedLongLong(pcg64_uint64(modulus, NULL));
+}
+
+
+static PyObject *
+pcg64_span(PyObject *self, PyObject *args)
+{
+    int long long left, right;
+    PyObject *err = NULL;
+    if(!PyArg_ParseTuple(args, "LL", &left, &right))
+    {
+        err = PyErr_Occurred();
+        if(!PyErr_GivenExceptionMatches(err, PyExc_OverflowError))
+        {
+            return NULL;
+        }
+    }
+    if(err != NULL || left < INT64_MIN || left > INT64_MAX || right < INT64_MIN || right > INT64_MAX || left >= right)
+    {
+        return PyErr_Format(
+            PyExc_ValueError,
+            "argument 1 must be less than argument 2; both must be integers in [%lld, %lld] ",
+            INT64_MIN < LLONG_MIN ? LLONG_MIN : INT64_MIN, INT64_MAX
+        );
+    }
+    return PyLong_FromLongLong(pcg64_span64(left, right, NULL));
+}
+
+
+static PyObject *
+pcg64_real(PyObject *self, PyObject *args)
+{
+    return PyFloat_FromDouble(pcg64_real64(NULL));
+}
+
+
+static PyObject *
+pcg64_drop(PyObject *self, PyObject *args)
+{
+    int long long count;
+    if(!PyArg_ParseTuple(args, "L", &count))
+    {
+        return NULL;
+    }
+    pcg64_drop64(count, NULL);
+    Py_RETURN_NONE;
+}
+
+
+static PyObject *
+pcg64_advance(PyObject *self, PyObject *args)
+{
+    int long long delta;
+    if(!PyArg_ParseTuple(args, "L", &delta))
+    {
+        return NULL;
+    }
+    pcg64_advance64(delta, NULL);
+    Py_RETURN_NONE;
+}
+
+
 // Module information.
 PyDoc_STRVAR(
     seed32_doc,
@@ -288,6 +429,75 @@ PyDoc_STRVAR(
     "discarding the results.\n\n"
     ":param count: Number of steps to advance the state by. If not positive, this function has no effect."
 );
+PyDoc_STRVAR(
+    back32_doc,
+    "back32(count)\n"
+    "Mutate 32-bit MT19937 by rewinding its internal state. Undoes ``count`` calls to ``rand32()``, so that the "
+    "numbers they generated are generated again.\n\n"
+    ":param count: Number of steps to rewind the state by. If not positive, this function has no effect."
+);
+PyDoc_STRVAR(
+    back64_doc,
+    "back64(count)\n"
+    "Mutate 64-bit MT19937 by rewinding its internal state. Undoes ``count`` calls to ``rand64()``, so that the "
+    "numbers they generated are generated again.\n\n"
+    ":param count: Number of steps to rewind the state by. If not positive, this function has no effect."
+);
+PyDoc_STRVAR(
+    pcg64_seed64_doc,
+    "pcg64_seed64(seed[, stream]) -> int\n"
+    "Seed PCG64. If ``stream`` is given, select that stream; otherwise, select the default one.\n\n"
+    ":param seed: 64-bit number.\n"
+    ":param stream: 64-bit number.\n\n"
+    ":return: The value used for seeding (``seed``)."
+);
+PyDoc_STRVAR(
+    pcg64_init64_doc,
+    "pcg64_init64() -> int\n"
+    "Seed PCG64 with a value generated in an unspecified manner at run-time, and select the default stream.\n\n"
+    ":return: The value used for seeding."
+);
+PyDoc_STRVAR(
+    pcg64_rand64_doc,
+    "pcg64_rand64() -> int\n"
+    "Generate a pseudorandom number using PCG64.\n\n"
+    ":return: Uniform pseudorandom 64-bit number."
+);
+PyDoc_STRVAR(
+    pcg64_uint64_doc,
+    "pcg64_uint64(modulus) -> int\n"
+    "Generate a pseudorandom residue using PCG64.\n\n"
+    ":param modulus: 64-bit number. Must not be 0.\n\n"
+    ":return: Uniform pseudorandom 64-bit number from 0 (inclusive) to ``modulus`` (exclusive)."
+);
+PyDoc_STRVAR(
+    pcg64_span64_doc,
+    "pcg64_span64(left, right) -> int\n"
+    "Generate a pseudorandom residue offset using PCG64.\n\n"
+    ":param left: 64-bit number.\n"
+    ":param right: 64-bit number. Must be greater than ``left``.\n\n"
+    ":return: Uniform pseudorandom 64-bit number from ``left`` (inclusive) to ``right`` (exclusive)."
+);
+PyDoc_STRVAR(
+    pcg64_real64_doc,
+    "pcg64_real64() -> float\n"
+    "Generate a pseudorandom fraction using PCG64.\n\n"
+    ":return: Uniform pseudorandom number from 0 (inclusive) to 1 (inclusive)."
+);
+PyDoc_STRVAR(
+    pcg64_drop64_doc,
+    "pcg64_drop64(count)\n"
+    "Mutate PCG64 by advancing its internal state. Equivalent to running ``pcg64_rand64()`` ``count`` times and "
+    "discarding the results, but takes time proportional to the logarithm of ``count``.\n\n"
+    ":param count: Number of steps to advance the state by. If not positive, this function has no effect."
+);
+PyDoc_STRVAR(
+    pcg64_advance64_doc,
+    "pcg64_advance64(delta)\n"
+    "Mutate PCG64 by advancing its internal state by ``delta`` steps in time proportional to the logarithm of "
+    "``delta``.\n\n"
+    ":param delta: Number of steps to advance the state by. If negative, the state goes back by ``-delta`` steps."
+);
 PyDoc_STRVAR(
     pymt19937_doc,
     "Python API for a C implementation of MT19937 "
@@ -309,6 +519,16 @@ static PyMethodDef pymt19937_methods[] =
     {"real64", real64, METH_NOARGS, real64_doc},
     {"drop32", drop32, METH_VARARGS, drop32_doc},
     {"drop64", drop64, METH_VARARGS, drop64_doc},
+    {"back32", back32, METH_VARARGS, back32_doc},
+    {"back64", back64, METH_VARARGS, back64_doc},
+    {"pcg64_seed64", pcg64_seed, METH_VARARGS, pcg64_seed64_doc},
+    {"pcg64_init64", pcg64_init, METH_NOARGS, pcg64_init64_doc},
+    {"pcg64_rand64", pcg64_rand, METH_NOARGS, pcg64_rand64_doc},
+    {"pcg64_uint64", pcg64_uint, METH_VARARGS, pcg64_uint64_doc},
+    {"pcg64_span64", pcg64_span, METH_VARARGS, pcg64_span64_doc},
+    {"pcg64_real64", pcg64_real, METH_NOARGS, pcg64_real64_doc},
+    {"pcg64_drop64", pcg64_drop, METH_VARARGS, pcg64_drop64_doc},
+    {"pcg64_advance64", pcg64_advance, METH_VARARGS, pcg64_advance64_doc},
     {NULL, NULL, 0, NULL},
 };
 static PyModuleDef pymt19937 =
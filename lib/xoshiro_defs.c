@@ -0,0 +1,134 @@
+/******************************************************************************
+ * Rotate a 64-bit word left.
+ *****************************************************************************/
+#ifndef XOSHIRO_ROTL
+#define XOSHIRO_ROTL(x, k) ((x) << (k) | (x) >> (64 - (k)))
+#endif
+
+/******************************************************************************
+ * Advance the state of a generator of the xoshiro/xoroshiro family by one
+ * step. Before including this file, define `XOSHIRO_NEXT(s, result)` to be a
+ * statement which stores the output of the current state in `result` and
+ * then updates the state `s`.
+ *
+ * @param state State (not necessarily that of an object).
+ *
+ * @return Pseudorandom number.
+ *****************************************************************************/
+MT19937_ALWAYS_INLINE
+static inline MT19937_WORD MT19937_NEXT(MT19937_WORD state[MT19937_STATE_LENGTH])
+{
+    MT19937_WORD result;
+    XOSHIRO_NEXT(state, result)
+    return result;
+}
+
+
+/******************************************************************************
+ * Jump ahead by a number of steps. Advancing the state by that number of steps
+ * is equivalent to multiplying it by a power of the characteristic polynomial
+ * of the generator, modulo that polynomial. Hence, the new state is a linear
+ * combination of the next few states.
+ *
+ * @param polynomial Coefficients of the jump polynomial (the first word holds
+ *     the least significant coefficients).
+ * @param mt Object.
+ *****************************************************************************/
+static void MT19937_JUMP_BY(MT19937_WORD const polynomial[MT19937_STATE_LENGTH], MT19937_OBJECT_TYPE *mt)
+{
+    MT19937_WORD state[MT19937_STATE_LENGTH] = {0};
+    for(int i = 0; i < MT19937_STATE_LENGTH; ++i)
+    {
+        for(int j = 0; j < MT19937_WORD_WIDTH; ++j)
+        {
+            if(polynomial[i] >> j & 1)
+            {
+                for(int k = 0; k < MT19937_STATE_LENGTH; ++k)
+                {
+                    state[k] ^= mt->state[k];
+                }
+            }
+            MT19937_NEXT(mt->state);
+        }
+    }
+    memcpy(mt->state, state, sizeof state);
+}
+
+
+MT19937_WORD MT19937_SEED(MT19937_WORD seed, MT19937_OBJECT_TYPE *mt)
+{
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+
+    // Expand the seed using SplitMix64, as the authors recommend. Its outputs
+    // are distinct, so the state is never zero.
+    MT19937_WORD splitmix = seed;
+    for(int i = 0; i < MT19937_STATE_LENGTH; ++i)
+    {
+        MT19937_WORD z = splitmix += 0x9E3779B97F4A7C15U;
+        z = (z ^ z >> 30) * 0xBF58476D1CE4E5B9U;
+        z = (z ^ z >> 27) * 0x94D049BB133111EBU;
+        mt->state[i] = z ^ z >> 31;
+    }
+    return seed;
+}
+
+
+MT19937_WORD MT19937_INIT(MT19937_OBJECT_TYPE *mt)
+{
+    time_t now = time(NULL);
+    int long long unsigned seed = djb2t(&now, sizeof now) + (uintptr_t)&mt;
+#ifndef __STDC_NO_THREADS__
+    thrd_t id = thrd_current();
+    seed += djb2t(&id, sizeof id);
+#endif
+    return MT19937_SEED(seed, mt);
+}
+
+
+MT19937_WORD MT19937_RAND(MT19937_OBJECT_TYPE *mt)
+{
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    return MT19937_NEXT(mt->state);
+}
+
+
+// Each number depends on the previous state, so there is nothing to vectorise.
+// Working on a local copy of the state keeps it in registers.
+void MT19937_FILL(MT19937_WORD *items, size_t num_of_items, MT19937_OBJECT_TYPE *mt)
+{
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    MT19937_WORD state[MT19937_STATE_LENGTH];
+    memcpy(state, mt->state, sizeof state);
+    for(size_t i = 0; i < num_of_items; ++i)
+    {
+        items[i] = MT19937_NEXT(state);
+    }
+    memcpy(mt->state, state, sizeof state);
+}
+
+
+void MT19937_DROP(int long long count, MT19937_OBJECT_TYPE *mt)
+{
+    mt = mt == NULL ? &MT19937_OBJECT : mt;
+    MT19937_WORD state[MT19937_STATE_LENGTH];
+    memcpy(state, mt->state, sizeof state);
+    for(int long long i = 0; i < count; ++i)
+    {
+        MT19937_NEXT(state);
+    }
+    memcpy(mt->state, state, sizeof state);
+}
+
+
+void MT19937_JUMP(MT19937_OBJECT_TYPE *mt)
+{
+    static MT19937_WORD const polynomial[MT19937_STATE_LENGTH] = XOSHIRO_JUMP;
+    MT19937_JUMP_BY(polynomial, mt == NULL ? &MT19937_OBJECT : mt);
+}
+
+
+void MT19937_LONG_JUMP(MT19937_OBJECT_TYPE *mt)
+{
+    static MT19937_WORD const polynomial[MT19937_STATE_LENGTH] = XOSHIRO_LONG_JUMP;
+    MT19937_JUMP_BY(polynomial, mt == NULL ? &MT19937_OBJECT : mt);
+}
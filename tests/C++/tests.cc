@@ -20,6 +20,15 @@ void tests(void)
     assert(mt32.rand32() == 0xF5CA0EDBU);
     assert(mt64.rand64() == 0x8A8592F5817ED872U);
 
+    mt19937::back32(10000);
+    mt32.back32(1);
+    mt19937::back64(10000);
+    mt64.back64(1);
+    assert(mt19937::rand32() == 0xD091BB5CU);
+    assert(mt19937::rand64() == 0xC96D191CF6F6AEA6U);
+    assert(mt32.rand32() == 0xF5CA0EDBU);
+    assert(mt64.rand64() == 0x8A8592F5817ED872U);
+
     mt19937::init32();
     for(int i = 0; i < 30000; ++i)
     {
@@ -47,6 +56,100 @@ void tests(void)
             assert(left <= middle && middle < right);
         }
     }
+
+    std::uint32_t items32[1000];
+    std::uint64_t items64[1000];
+    mt32.seed32(5489);
+    mt64.seed64(5489);
+    mt32.fill32(items32, 1000);
+    mt64.fill64(items64, 1000);
+    mt32.seed32(5489);
+    mt64.seed64(5489);
+    for(int i = 0; i < 1000; ++i)
+    {
+        assert(items32[i] == mt32.rand32());
+        assert(items64[i] == mt64.rand64());
+    }
+}
+
+/******************************************************************************
+ * Test Philox4x32-10 in C++.
+ *****************************************************************************/
+void tests_philox(void)
+{
+    philox_32_t ph(20111115);
+    philox::seed32(20111115);
+
+    philox::drop32(9999);
+    ph.drop32(9999);
+
+    assert(philox::rand32() == 1955073260U);
+    assert(ph.rand32() == 1955073260U);
+
+    std::uint32_t items[1000];
+    ph.seek32(0);
+    ph.fill32(items, 1000);
+    ph.seek32(0);
+    for(int i = 0; i < 1000; ++i)
+    {
+        assert(items[i] == ph.rand32());
+    }
+}
+
+/******************************************************************************
+ * Test xoshiro256** and xoroshiro128+ in C++.
+ *****************************************************************************/
+void tests_xoshiro(void)
+{
+    xoshiro256ss_64_t xs;
+    xoshiro256ss::seed64(5489);
+    xoshiro256ss::drop64(9999);
+    xs.drop64(9999);
+    assert(xoshiro256ss::rand64() == 10745431899595660155U);
+    assert(xs.rand64() == 10745431899595660155U);
+    xs.seed64(5489);
+    xs.jump64();
+    assert(xs.rand64() == 6182566321287234414U);
+
+    xoroshiro128p_64_t xr;
+    xoroshiro128p::seed64(5489);
+    xoroshiro128p::drop64(9999);
+    xr.drop64(9999);
+    assert(xoroshiro128p::rand64() == 1916635441298572912U);
+    assert(xr.rand64() == 1916635441298572912U);
+    xr.seed64(5489);
+    xr.long_jump64();
+    assert(xr.rand64() == 6769295549289358569U);
+}
+
+/******************************************************************************
+ * Test PCG64 in C++.
+ *****************************************************************************/
+void tests_pcg(void)
+{
+    pcg64_64_t pc(42, 54);
+    assert(pc.rand64() == 0x86B1DA1D72062B68U);
+    pc.advance64(12344);
+    assert(pc.rand64() == 0x8A61914917CE5BADU);
+
+    pcg64::seed64(5489);
+    pcg64::drop64(9999);
+    assert(pcg64::rand64() == 11848941491667721546U);
+}
+
+/******************************************************************************
+ * Test the generators with dynamically created parameter sets in C++.
+ *****************************************************************************/
+void tests_dcmt(void)
+{
+    dcmt521_32_t dc521;
+    assert(dc521.rand32() == 0x4BBDC57AU);
+    assert(dc521.rand32() == 0xAD83133DU);
+    dcmt2203_32_t dc2203(1, 1);
+    assert(dc2203.rand32() == 0xEFABE31EU);
+
+    dcmt2203::drop32(9999);
+    assert(dcmt2203::rand32() == 1887449133U);
 }
 
 /******************************************************************************
@@ -55,4 +158,8 @@ void tests(void)
 int main(void)
 {
     tests();
+    tests_philox();
+    tests_xoshiro();
+    tests_pcg();
+    tests_dcmt();
 }
@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <inttypes.h>
 #include <mt19937.h>
+#include <string.h>
 
 /******************************************************************************
  * Test MT19937 in C.
@@ -49,6 +50,386 @@ void tests(void)
             assert(left <= middle && middle < right);
         }
     }
+
+    // Filling must be equivalent to generating one number at a time, no
+    // matter where in the state the object is.
+    uint32_t items32[1500];
+    uint64_t items64[1500];
+    for(int offset = 0; offset < 700; offset += 233)
+    {
+        mt19937_seed32(offset, &mt32);
+        mt19937_seed64(offset, &mt64);
+        mt19937_drop32(offset, &mt32);
+        mt19937_drop64(offset, &mt64);
+        mt19937_fill32(items32, 1500, &mt32);
+        mt19937_fill64(items64, 1500, &mt64);
+        uint32_t next32 = mt19937_rand32(&mt32);
+        uint64_t next64 = mt19937_rand64(&mt64);
+        mt19937_seed32(offset, &mt32);
+        mt19937_seed64(offset, &mt64);
+        mt19937_drop32(offset, &mt32);
+        mt19937_drop64(offset, &mt64);
+        for(int i = 0; i < 1500; ++i)
+        {
+            assert(items32[i] == mt19937_rand32(&mt32));
+            assert(items64[i] == mt19937_rand64(&mt64));
+        }
+        assert(next32 == mt19937_rand32(&mt32));
+        assert(next64 == mt19937_rand64(&mt64));
+    }
+}
+
+/******************************************************************************
+ * Test Philox4x32-10 in C.
+ *****************************************************************************/
+void tests_philox(void)
+{
+    // Known-answer tests from the Random123 library.
+    struct philox_32_t ph;
+    philox_seed32(0, &ph);
+    assert(philox_rand32(&ph) == 0x6627E8D5U);
+    assert(philox_rand32(&ph) == 0xE169C58DU);
+    assert(philox_rand32(&ph) == 0xBC57AC4CU);
+    assert(philox_rand32(&ph) == 0x9B00DBD8U);
+    uint32_t key[] = {0xA4093822U, 0x299F31D0U};
+    uint32_t counter[] = {0x243F6A88U, 0x85A308D3U, 0x13198A2EU, 0x03707344U};
+    memcpy(ph.key, key, sizeof key);
+    memcpy(ph.counter, counter, sizeof counter);
+    --ph.counter[0];
+    ph.index = 4;
+    assert(philox_rand32(&ph) == 0xD16CFE09U);
+    assert(philox_rand32(&ph) == 0x94FDCCEBU);
+    assert(philox_rand32(&ph) == 0x5001E420U);
+    assert(philox_rand32(&ph) == 0x24126EA1U);
+
+    // The 10000th number generated by `std::philox4x32` of C++26.
+    philox_seed32(20111115, &ph);
+    philox_drop32(9999, &ph);
+    assert(philox_rand32(&ph) == 1955073260U);
+    philox_seed32(20111115, &ph);
+    philox_seek32(9999, &ph);
+    assert(philox_rand32(&ph) == 1955073260U);
+
+    // Filling must be equivalent to generating one number at a time.
+    uint32_t items[1500];
+    for(int offset = 0; offset < 8; offset += 3)
+    {
+        philox_seed32(offset, &ph);
+        philox_drop32(offset, &ph);
+        philox_fill32(items, 1500, &ph);
+        uint32_t next = philox_rand32(&ph);
+        philox_seek32(offset, &ph);
+        for(int i = 0; i < 1500; ++i)
+        {
+            assert(items[i] == philox_rand32(&ph));
+        }
+        assert(next == philox_rand32(&ph));
+    }
+
+    philox_init32(NULL);
+    for(int i = 0; i < 30000; ++i)
+    {
+        uint32_t modulus = philox_rand32(NULL);
+        assert(philox_uint32(modulus, NULL) < modulus);
+        int32_t left = philox_rand32(NULL);
+        int32_t right = philox_rand32(NULL);
+        if(left < right)
+        {
+            int32_t middle = philox_span32(left, right, NULL);
+            assert(left <= middle && middle < right);
+        }
+    }
+}
+
+/******************************************************************************
+ * Test the xoshiro256** and xoroshiro128+ generators.
+ *****************************************************************************/
+void tests_xoshiro(void)
+{
+    // Outputs of the reference implementations from a fixed state.
+    struct xoshiro256ss_64_t xs = {{1, 2, 3, 4}};
+    assert(xoshiro256ss_rand64(&xs) == 11520U);
+    assert(xoshiro256ss_rand64(&xs) == 0U);
+    assert(xoshiro256ss_rand64(&xs) == 1509978240U);
+    assert(xoshiro256ss_rand64(&xs) == 1215971899390074240U);
+    struct xoroshiro128p_64_t xr = {{1, 2}};
+    assert(xoroshiro128p_rand64(&xr) == 3U);
+    assert(xoroshiro128p_rand64(&xr) == 412333834243U);
+    assert(xoroshiro128p_rand64(&xr) == 2360170716294286339U);
+    assert(xoroshiro128p_rand64(&xr) == 9295852285959843169U);
+
+    // The 10000th number generated. The internal objects must have been
+    // seeded with 5489.
+    xoshiro256ss_drop64(9999, NULL);
+    assert(xoshiro256ss_rand64(NULL) == 10745431899595660155U);
+    xoshiro256ss_seed64(5489, &xs);
+    xoshiro256ss_drop64(9999, &xs);
+    assert(xoshiro256ss_rand64(&xs) == 10745431899595660155U);
+    xoroshiro128p_drop64(9999, NULL);
+    assert(xoroshiro128p_rand64(NULL) == 1916635441298572912U);
+    xoroshiro128p_seed64(5489, &xr);
+    xoroshiro128p_drop64(9999, &xr);
+    assert(xoroshiro128p_rand64(&xr) == 1916635441298572912U);
+
+    // Jumps.
+    xoshiro256ss_seed64(5489, &xs);
+    xoshiro256ss_jump64(&xs);
+    assert(xoshiro256ss_rand64(&xs) == 6182566321287234414U);
+    xoshiro256ss_seed64(5489, &xs);
+    xoshiro256ss_long_jump64(&xs);
+    assert(xoshiro256ss_rand64(&xs) == 2837704607874969582U);
+    xoroshiro128p_seed64(5489, &xr);
+    xoroshiro128p_jump64(&xr);
+    assert(xoroshiro128p_rand64(&xr) == 7099435510140476216U);
+    xoroshiro128p_seed64(5489, &xr);
+    xoroshiro128p_long_jump64(&xr);
+    assert(xoroshiro128p_rand64(&xr) == 6769295549289358569U);
+
+    // Filling must be equivalent to generating one number at a time.
+    uint64_t items[1000];
+    xoshiro256ss_seed64(1, &xs);
+    xoshiro256ss_fill64(items, 1000, &xs);
+    uint64_t next = xoshiro256ss_rand64(&xs);
+    xoshiro256ss_seed64(1, &xs);
+    for(int i = 0; i < 1000; ++i)
+    {
+        assert(items[i] == xoshiro256ss_rand64(&xs));
+    }
+    assert(next == xoshiro256ss_rand64(&xs));
+    xoroshiro128p_seed64(1, &xr);
+    xoroshiro128p_fill64(items, 1000, &xr);
+    next = xoroshiro128p_rand64(&xr);
+    xoroshiro128p_seed64(1, &xr);
+    for(int i = 0; i < 1000; ++i)
+    {
+        assert(items[i] == xoroshiro128p_rand64(&xr));
+    }
+    assert(next == xoroshiro128p_rand64(&xr));
+
+    xoshiro256ss_init64(NULL);
+    xoroshiro128p_init64(NULL);
+    for(int i = 0; i < 30000; ++i)
+    {
+        uint64_t modulus = xoshiro256ss_rand64(NULL);
+        assert(xoshiro256ss_uint64(modulus, NULL) < modulus);
+        modulus = xoroshiro128p_rand64(NULL);
+        assert(xoroshiro128p_uint64(modulus, NULL) < modulus);
+        int64_t left = xoshiro256ss_rand64(NULL);
+        int64_t right = xoroshiro128p_rand64(NULL);
+        if(left < right)
+        {
+            int64_t middle = xoshiro256ss_span64(left, right, NULL);
+            assert(left <= middle && middle < right);
+            middle = xoroshiro128p_span64(left, right, NULL);
+            assert(left <= middle && middle < right);
+        }
+    }
+}
+
+/******************************************************************************
+ * Test the PCG64 generator.
+ *****************************************************************************/
+void tests_pcg(void)
+{
+    // Output of the reference implementation.
+    struct pcg64_64_t pc;
+    pcg64_seed_stream64(42, 54, &pc);
+    assert(pcg64_rand64(&pc) == 0x86B1DA1D72062B68U);
+    assert(pcg64_rand64(&pc) == 0x1304AA46C9853D39U);
+    assert(pcg64_rand64(&pc) == 0xA3670E9E0DD50358U);
+    assert(pcg64_rand64(&pc) == 0xF9090E529A7DAE00U);
+
+    // The 10000th number generated. The internal object must have been seeded
+    // with 5489.
+    pcg64_drop64(9999, NULL);
+    assert(pcg64_rand64(NULL) == 11848941491667721546U);
+    pcg64_seed64(5489, &pc);
+    for(int i = 0; i < 9999; ++i)
+    {
+        pcg64_rand64(&pc);
+    }
+    assert(pcg64_rand64(&pc) == 11848941491667721546U);
+
+    // Advancing must be equivalent to generating numbers one at a time.
+    pcg64_seed_stream64(42, 54, &pc);
+    pcg64_advance64(12345, &pc);
+    assert(pcg64_rand64(&pc) == 0x8A61914917CE5BADU);
+    pcg64_advance64(-1, &pc);
+    assert(pcg64_rand64(&pc) == 0x8A61914917CE5BADU);
+
+    // Filling must be equivalent to generating one number at a time.
+    uint64_t items[1000];
+    pcg64_seed_stream64(1, 2, &pc);
+    pcg64_fill64(items, 1000, &pc);
+    uint64_t next = pcg64_rand64(&pc);
+    pcg64_seed_stream64(1, 2, &pc);
+    for(int i = 0; i < 1000; ++i)
+    {
+        assert(items[i] == pcg64_rand64(&pc));
+    }
+    assert(next == pcg64_rand64(&pc));
+
+    pcg64_init64(NULL);
+    for(int i = 0; i < 30000; ++i)
+    {
+        uint64_t modulus = pcg64_rand64(NULL);
+        assert(pcg64_uint64(modulus, NULL) < modulus);
+        int64_t left = pcg64_rand64(NULL);
+        int64_t right = pcg64_rand64(NULL);
+        if(left < right)
+        {
+            int64_t middle = pcg64_span64(left, right, NULL);
+            assert(left <= middle && middle < right);
+        }
+    }
+}
+
+/******************************************************************************
+ * Test the generators with dynamically created parameter sets.
+ *****************************************************************************/
+void tests_dcmt(void)
+{
+    // The 10000th number generated with the first parameter set. The internal
+    // objects must have been seeded with 5489.
+    dcmt521_drop32(9999, NULL);
+    assert(dcmt521_rand32(NULL) == 2472858935U);
+    dcmt2203_drop32(9999, NULL);
+    assert(dcmt2203_rand32(NULL) == 1887449133U);
+
+    struct dcmt521_32_t dc521;
+    assert(dcmt521_select32(0, &dc521) == 0);
+    dcmt521_seed32(5489, &dc521);
+    assert(dcmt521_rand32(&dc521) == 0x4BBDC57AU);
+    assert(dcmt521_rand32(&dc521) == 0xAD83133DU);
+    assert(dcmt521_select32(1, &dc521) == 0);
+    dcmt521_seed32(5489, &dc521);
+    assert(dcmt521_rand32(&dc521) == 0x4BBDC57AU);
+    assert(dcmt521_rand32(&dc521) == 0xB2739340U);
+    assert(dcmt521_select32(4096, &dc521) == -1);
+
+    struct dcmt2203_32_t dc2203;
+    assert(dcmt2203_select32(1, &dc2203) == 0);
+    dcmt2203_seed32(1, &dc2203);
+    assert(dcmt2203_rand32(&dc2203) == 0xEFABE31EU);
+    assert(dcmt2203_rand32(&dc2203) == 0x4A9BF3F3U);
+    assert(dcmt2203_select32(256, &dc2203) == -1);
+
+    // Filling must be equivalent to generating one number at a time.
+    uint32_t items[1000];
+    dcmt2203_seed32(2, &dc2203);
+    dcmt2203_fill32(items, 1000, &dc2203);
+    uint32_t next = dcmt2203_rand32(&dc2203);
+    dcmt2203_seed32(2, &dc2203);
+    for(int i = 0; i < 1000; ++i)
+    {
+        assert(items[i] == dcmt2203_rand32(&dc2203));
+    }
+    assert(next == dcmt2203_rand32(&dc2203));
+
+    dcmt521_init32(NULL);
+    for(int i = 0; i < 30000; ++i)
+    {
+        uint32_t modulus = dcmt521_rand32(NULL);
+        assert(dcmt521_uint32(modulus, NULL) < modulus);
+        int32_t left = dcmt521_rand32(NULL);
+        int32_t right = dcmt521_rand32(NULL);
+        if(left < right)
+        {
+            int32_t middle = dcmt521_span32(left, right, NULL);
+            assert(left <= middle && middle < right);
+        }
+    }
+}
+
+/******************************************************************************
+ * Test rewinding MT19937.
+ *****************************************************************************/
+void tests_back(void)
+{
+    struct mt19937_32_t mt32;
+    mt19937_seed32(5489, &mt32);
+    struct mt19937_64_t mt64;
+    mt19937_seed64(5489, &mt64);
+    uint32_t items32[3000];
+    uint64_t items64[3000];
+    mt19937_fill32(items32, 3000, &mt32);
+    mt19937_fill64(items64, 3000, &mt64);
+
+    // Rewinding by any distance must make the numbers generated in that many
+    // preceding steps be generated again. The distances are chosen to stop
+    // at, just before and just after the boundaries of the states.
+    int long long counts[] = {0, -1, 1, 311, 312, 313, 504, 505, 623, 624, 625, 1128, 1129, 2999, 3000};
+    for(size_t i = 0; i < sizeof counts / sizeof *counts; ++i)
+    {
+        int long long count = counts[i] > 0 ? counts[i] : 0;
+        uint32_t again32[3000];
+        uint64_t again64[3000];
+        mt19937_back32(counts[i], &mt32);
+        mt19937_fill32(again32, count, &mt32);
+        assert(memcmp(again32, items32 + 3000 - count, count * sizeof *again32) == 0);
+        mt19937_back64(counts[i], &mt64);
+        mt19937_fill64(again64, count, &mt64);
+        assert(memcmp(again64, items64 + 3000 - count, count * sizeof *again64) == 0);
+    }
+
+    // Rewinding past the point of seeding and returning must lead to the
+    // same numbers.
+    mt19937_seed32(5489, NULL);
+    mt19937_back32(10000, NULL);
+    mt19937_drop32(10000, NULL);
+    assert(mt19937_rand32(NULL) == items32[0]);
+    mt19937_seed64(5489, NULL);
+    mt19937_back64(1, NULL);
+    mt19937_drop64(1, NULL);
+    assert(mt19937_rand64(NULL) == items64[0]);
+
+    // The generators with dynamically created parameter sets use the same
+    // functions.
+    struct dcmt521_32_t dc521;
+    dcmt521_select32(7, &dc521);
+    dcmt521_seed32(5489, &dc521);
+    dcmt521_fill32(items32, 100, &dc521);
+    dcmt521_back32(100, &dc521);
+    for(int i = 0; i < 100; ++i)
+    {
+        assert(dcmt521_rand32(&dc521) == items32[i]);
+    }
+}
+
+/******************************************************************************
+ * Test the instrumentation counters, if enabled.
+ *****************************************************************************/
+void tests_stats(void)
+{
+#ifdef MT19937_STATS
+    struct mt19937_32_t mt32;
+    mt19937_seed32(5489, &mt32);
+    for(int i = 0; i < 1000; ++i)
+    {
+        mt19937_uint32(0x80000001U, &mt32);
+    }
+    mt19937_drop32(624, &mt32);
+    struct mt19937_stats_t stats = mt19937_stats_get32(&mt32);
+    assert(stats.seed == 1 && stats.uint == 1000 && stats.drop == 1 && stats.drop_steps == 624);
+    assert(stats.rand == 1000 + stats.rejections + 624);
+    assert(stats.twists == (stats.rand + 623) / 624);
+    uint64_t twists = stats.twists;
+    mt19937_back32(2000, &mt32);
+    stats = mt19937_stats_get32(&mt32);
+    assert(stats.back == 1 && stats.back_steps == 2000 && stats.twists == twists);
+    mt19937_stats_reset32(&mt32);
+    stats = mt19937_stats_get32(&mt32);
+    assert(stats.rand == 0 && stats.twists == 0);
+
+    mt19937_stats_reset64(NULL);
+    mt19937_rand64(NULL);
+    mt19937_real64(NULL);
+    stats = mt19937_stats_get64(NULL);
+    assert(stats.rand == 2 && stats.real == 1);
+    mt19937_seed64(5489, NULL);
+    stats = mt19937_stats_get64(NULL);
+    assert(stats.seed == 1 && stats.rand == 0 && stats.real == 0);
+#endif
 }
 
 /******************************************************************************
@@ -57,4 +438,10 @@ void tests(void)
 int main(void)
 {
     tests();
+    tests_philox();
+    tests_xoshiro();
+    tests_pcg();
+    tests_dcmt();
+    tests_back();
+    tests_stats();
 }
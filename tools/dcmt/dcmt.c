@@ -0,0 +1,333 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mt19937.h"
+
+/******************************************************************************
+ * Search for parameter sets of Mersenne Twisters with a small Mersenne prime
+ * exponent, in the manner of Matsumoto and Nishimura's Dynamic Creator.
+ *
+ * A parameter set is the twist matrix: a 32-bit word `a` whose least
+ * significant 16 bits are the set index, whose most significant bit is set
+ * (so that the recurrence is invertible) and whose other bits are chosen at
+ * random until the characteristic polynomial of the recurrence is primitive.
+ * Since the exponent is a Mersenne prime exponent, it suffices to check that
+ * the polynomial is irreducible. Distinct indices give distinct polynomials,
+ * which are hence coprime, so the generators are independent of one another.
+ *
+ * The characteristic polynomial is found by running the recurrence and
+ * applying the Berlekamp-Massey algorithm to one bit of the words generated.
+ * Polynomials with a small factor are discarded quickly; the rest are tested
+ * using Rabin's irreducibility test.
+ *
+ * The tempering parameters are not searched for; those of MT19937 are used.
+ *****************************************************************************/
+
+// Polynomials over GF(2) are stored as arrays of words, the first of which
+// holds the coefficients of the lowest powers.
+#define WORDS(degree) ((degree) / 64 + 2)
+
+// Degree up to which factors are looked for before the full test.
+#define SIEVE_DEGREE 16
+
+static int exponent, length, middle, lower_bits, words;
+static uint64_t spread_table[0x10000];
+static uint64_t *shifted_modulus, *reversed, *connection, *previous, *scratch, *power, *product, *dividend, *divisor;
+
+/******************************************************************************
+ * Find the degree of a polynomial.
+ *
+ * @param f Polynomial.
+ * @param num_of_words Number of words in the polynomial.
+ *
+ * @return Degree (-1 if the polynomial is zero).
+ *****************************************************************************/
+static int degree(uint64_t const *f, int num_of_words)
+{
+    for(int i = num_of_words - 1; i >= 0; --i)
+    {
+        if(f[i] != 0)
+        {
+            return i * 64 + 63 - __builtin_clzll(f[i]);
+        }
+    }
+    return -1;
+}
+
+
+/******************************************************************************
+ * XOR a polynomial multiplied by a power of x into another polynomial.
+ *
+ * @param dst Polynomial to modify.
+ * @param src Polynomial to multiply.
+ * @param src_degree Degree of `src`.
+ * @param shift Power of x to multiply `src` by.
+ *****************************************************************************/
+static void xor_shifted(uint64_t *dst, uint64_t const *src, int src_degree, int shift)
+{
+    int offset = shift / 64, bits = shift % 64;
+    int num_of_words = src_degree / 64 + 1;
+    for(int i = 0; i < num_of_words; ++i)
+    {
+        dst[i + offset] ^= src[i] << bits;
+        if(bits > 0)
+        {
+            dst[i + offset + 1] ^= src[i] >> (64 - bits);
+        }
+    }
+}
+
+
+/******************************************************************************
+ * Prepare to square polynomials modulo another: store the modulus multiplied
+ * by each power of x less than 64, so that it need not be shifted while
+ * reducing products.
+ *
+ * @param f Modulus (of degree `exponent`).
+ *****************************************************************************/
+static void prepare_modulus(uint64_t const *f)
+{
+    memset(shifted_modulus, 0, 64 * words * sizeof *shifted_modulus);
+    for(int i = 0; i < 64; ++i)
+    {
+        xor_shifted(shifted_modulus + i * words, f, exponent, i);
+    }
+}
+
+
+/******************************************************************************
+ * Square a polynomial modulo another. Squaring a polynomial over GF(2) spreads
+ * its coefficients apart.
+ *
+ * @param g Polynomial to square (of degree less than `exponent`). The result
+ *     is stored in it.
+ *****************************************************************************/
+static void square_mod(uint64_t *g)
+{
+    int num_of_words = (exponent - 1) / 64 + 1;
+    for(int i = 0; i < num_of_words; ++i)
+    {
+        for(int j = 0; j < 4; ++j)
+        {
+            uint64_t spread = spread_table[g[i] >> 16 * j & 0xFFFFU];
+            product[2 * i + j / 2] = j % 2 == 0 ? spread : product[2 * i + j / 2] | spread << 32;
+        }
+    }
+    for(int i = 2 * exponent - 2; i >= exponent; --i)
+    {
+        if(product[i / 64] >> i % 64 & 1)
+        {
+            int shift = i - exponent;
+            uint64_t const *multiple = shifted_modulus + shift % 64 * words;
+            uint64_t *dst = product + shift / 64;
+            for(int j = 0; j <= num_of_words; ++j)
+            {
+                dst[j] ^= multiple[j];
+            }
+        }
+    }
+    memcpy(g, product, num_of_words * sizeof *g);
+}
+
+
+/******************************************************************************
+ * Check whether two polynomials are coprime.
+ *
+ * @param f Polynomial (of degree `exponent`).
+ * @param g Polynomial (of degree less than that of `f`).
+ *
+ * @return 1 if they are coprime, else 0.
+ *****************************************************************************/
+static int coprime(uint64_t const *f, uint64_t const *g)
+{
+    memcpy(dividend, f, words * sizeof *dividend);
+    memcpy(divisor, g, words * sizeof *divisor);
+    uint64_t *a = dividend, *b = divisor;
+    int degree_a = degree(a, words), degree_b = degree(b, words);
+    while(degree_b > 0)
+    {
+        while(degree_a >= degree_b)
+        {
+            xor_shifted(a, b, degree_b, degree_a - degree_b);
+            degree_a = degree(a, degree_a / 64 + 1);
+        }
+        uint64_t *tmp = a;
+        a = b;
+        b = tmp;
+        int degree_tmp = degree_a;
+        degree_a = degree_b;
+        degree_b = degree_tmp;
+    }
+    return degree_b == 0;
+}
+
+
+/******************************************************************************
+ * Check whether a polynomial of prime degree is irreducible. It is if and only
+ * if x ** (2 ** exponent) = x modulo it, and it has no linear factor. Before
+ * that is checked, factors of low degree are looked for, since most
+ * polynomials have one.
+ *
+ * @param f Polynomial (of degree `exponent`).
+ *
+ * @return 1 if it is irreducible, else 0.
+ *****************************************************************************/
+static int irreducible(uint64_t const *f)
+{
+    prepare_modulus(f);
+    memset(power, 0, words * sizeof *power);
+    power[0] = 2;
+    for(int i = 1; i <= exponent; ++i)
+    {
+        square_mod(power);
+        if(i <= SIEVE_DEGREE)
+        {
+            // Look for factors of degree `i`.
+            power[0] ^= 2;
+            int result = coprime(f, power);
+            power[0] ^= 2;
+            if(!result)
+            {
+                return 0;
+            }
+        }
+    }
+    power[0] ^= 2;
+    return degree(power, words) == -1;
+}
+
+
+/******************************************************************************
+ * Find the characteristic polynomial of the recurrence with the given twist
+ * matrix, using the Berlekamp-Massey algorithm. The result is the connection
+ * polynomial, which is the reciprocal of the characteristic polynomial and is
+ * irreducible if and only if it is.
+ *
+ * @param a Twist matrix.
+ *
+ * @return 1 if the polynomial (stored in `connection`) has degree `exponent`,
+ *     else 0.
+ *****************************************************************************/
+static int characteristic(uint32_t a)
+{
+    // Generate twice as many bits as the degree.
+    uint32_t state[length];
+    uint32_t upper_mask = 0xFFFFFFFFU << lower_bits;
+    state[0] = 4357;
+    for(int i = 1; i < length; ++i)
+    {
+        state[i] = 1812433253U * (state[i - 1] ^ state[i - 1] >> 30) + i;
+    }
+    int num_of_bits = 2 * exponent;
+    memset(reversed, 0, 2 * words * sizeof *reversed);
+    for(int i = 0, j = 0; i < num_of_bits; ++i, j = (j + 1) % length)
+    {
+        uint32_t combo = (state[j] & upper_mask) | (state[(j + 1) % length] & ~upper_mask);
+        state[j] = state[(j + middle) % length] ^ combo >> 1 ^ (-(combo & 1) & a);
+        if(state[j] >> 31)
+        {
+            int k = num_of_bits - 1 - i;
+            reversed[k / 64] |= (uint64_t)1 << k % 64;
+        }
+    }
+
+    memset(connection, 0, words * sizeof *connection);
+    memset(previous, 0, words * sizeof *previous);
+    connection[0] = previous[0] = 1;
+    int linear_complexity = 0, shift = 1;
+    for(int n = 0; n < num_of_bits; ++n)
+    {
+        // The discrepancy is the sum of the products of the coefficients and
+        // the bits preceding bit `n` (in reverse order), which are the bits of
+        // the reversed sequence starting at `base`.
+        int base = num_of_bits - 1 - n;
+        int offset = base / 64, bits = base % 64;
+        uint64_t discrepancy = 0;
+        for(int i = 0; i <= linear_complexity / 64; ++i)
+        {
+            uint64_t window = reversed[offset + i] >> bits;
+            if(bits > 0)
+            {
+                window |= reversed[offset + i + 1] << (64 - bits);
+            }
+            discrepancy ^= connection[i] & window;
+        }
+        if(__builtin_parityll(discrepancy) == 0)
+        {
+            ++shift;
+            continue;
+        }
+        if(2 * linear_complexity <= n)
+        {
+            memcpy(scratch, connection, words * sizeof *scratch);
+            xor_shifted(connection, previous, degree(previous, words), shift);
+            memcpy(previous, scratch, words * sizeof *previous);
+            linear_complexity = n + 1 - linear_complexity;
+            shift = 1;
+        }
+        else
+        {
+            xor_shifted(connection, previous, degree(previous, words), shift);
+            ++shift;
+        }
+    }
+    return linear_complexity == exponent && degree(connection, words) == exponent;
+}
+
+
+/******************************************************************************
+ * Main function.
+ *****************************************************************************/
+int main(int const argc, char const *argv[])
+{
+    if(argc < 4)
+    {
+        fprintf(stderr, "Usage:\n  %s EXPONENT FIRST COUNT [SEED]\n", argv[0]);
+        fprintf(stderr, "Print the twist matrices of parameter sets FIRST to FIRST + COUNT - 1.\n");
+        return EXIT_FAILURE;
+    }
+    exponent = atoi(argv[1]);
+    int first = atoi(argv[2]);
+    int count = atoi(argv[3]);
+    if(exponent < 64 || first < 0 || count < 0 || first + count > 0x10000)
+    {
+        fprintf(stderr, "The exponent must be at least 64, and the indices less than 65536.\n");
+        return EXIT_FAILURE;
+    }
+    length = (exponent + 31) / 32;
+    middle = length / 2;
+    lower_bits = 32 * length - exponent;
+    words = WORDS(2 * exponent);
+    uint64_t **arrays[] = {&reversed, &connection, &previous, &scratch, &power, &product, &dividend, &divisor};
+    for(size_t i = 0; i < sizeof arrays / sizeof *arrays; ++i)
+    {
+        *arrays[i] = calloc(2 * words, sizeof **arrays[i]);
+    }
+    shifted_modulus = calloc(64 * words, sizeof *shifted_modulus);
+    for(uint64_t i = 0; i < 0x10000; ++i)
+    {
+        for(int j = 0; j < 16; ++j)
+        {
+            spread_table[i] |= (i >> j & 1) << 2 * j;
+        }
+    }
+    mt19937_seed32(argc > 4 ? strtoul(argv[4], NULL, 10) : 5489, NULL);
+
+    for(int index = first; index < first + count; ++index)
+    {
+        uint32_t a;
+        do
+        {
+            a = 0x80000000U | (mt19937_rand32(NULL) & 0x7FFF0000U) | index;
+        }
+        while(!characteristic(a) || !irreducible(connection));
+        printf("0x%08" PRIX32 "U,%c", a, (index - first) % 8 == 7 ? '\n' : ' ');
+        fflush(stdout);
+    }
+    if(count % 8 != 0)
+    {
+        printf("\n");
+    }
+}
@@ -0,0 +1,245 @@
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <sys/uio.h>
+#endif
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <malloc.h>
+#endif
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "mt19937.h"
+
+/******************************************************************************
+ * Write pseudorandom bytes to standard output for ever, for use with
+ * statistical test suites (which read them from a pipe) and load generators.
+ *
+ * The numbers are generated in bulk into page-aligned buffers. On Linux, if
+ * standard output is a pipe, the buffers are spliced into it with `vmsplice`
+ * instead of being copied into it. A buffer must then not be refilled until
+ * the reader has consumed it. The pipe is made exactly as large as a buffer,
+ * and two buffers are used alternately: once one buffer has been spliced
+ * entirely into the pipe, the pipe has held all of it, so the other buffer
+ * has been consumed, and can be refilled.
+ *****************************************************************************/
+
+#define PAGE_SIZE 4096
+#define BUFFER_SIZE (1 << 20)
+
+// Wrappers giving all generators the same signatures. Each uses its internal
+// object.
+#define STREAM_ENGINE(engine, width)  \
+static void engine##_##width##_seed(uint64_t seed)  \
+{  \
+    engine##_seed##width(seed, NULL);  \
+}  \
+static void engine##_##width##_fill(void *buffer, size_t size)  \
+{  \
+    engine##_fill##width(buffer, size / sizeof(uint##width##_t), NULL);  \
+}
+
+STREAM_ENGINE(mt19937, 32)
+STREAM_ENGINE(mt19937, 64)
+STREAM_ENGINE(philox, 32)
+STREAM_ENGINE(xoshiro256ss, 64)
+STREAM_ENGINE(xoroshiro128p, 64)
+STREAM_ENGINE(pcg64, 64)
+STREAM_ENGINE(dcmt521, 32)
+STREAM_ENGINE(dcmt2203, 32)
+
+// The largest seed accepted is that of the seeding function, which is not
+// necessarily the largest number of the word width.
+#define STREAM_ENGINE_ENTRY(engine, width, seed_max)  \
+    {#engine "_" #width, seed_max, engine##_##width##_seed, engine##_##width##_fill}
+
+static struct
+{
+    char const *name;
+    uint64_t seed_max;
+    void (*seed)(uint64_t);
+    void (*fill)(void *, size_t);
+}
+const engines[] =
+{
+    STREAM_ENGINE_ENTRY(mt19937, 32, UINT32_MAX),
+    STREAM_ENGINE_ENTRY(mt19937, 64, UINT64_MAX),
+    STREAM_ENGINE_ENTRY(philox, 32, UINT64_MAX),
+    STREAM_ENGINE_ENTRY(xoshiro256ss, 64, UINT64_MAX),
+    STREAM_ENGINE_ENTRY(xoroshiro128p, 64, UINT64_MAX),
+    STREAM_ENGINE_ENTRY(pcg64, 64, UINT64_MAX),
+    STREAM_ENGINE_ENTRY(dcmt521, 32, UINT32_MAX),
+    STREAM_ENGINE_ENTRY(dcmt2203, 32, UINT32_MAX),
+};
+
+
+/******************************************************************************
+ * Write a buffer to standard output.
+ *
+ * @param buffer Buffer.
+ * @param size Size of the buffer.
+ *
+ * @return 1 if it was written entirely, else 0.
+ *****************************************************************************/
+static int write_all(char const *buffer, size_t size)
+{
+    while(size > 0)
+    {
+        ssize_t written = write(STDOUT_FILENO, buffer, size);
+        if(written < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            return 0;
+        }
+        buffer += written;
+        size -= written;
+    }
+    return 1;
+}
+
+
+#ifdef __linux__
+/******************************************************************************
+ * Splice a buffer into standard output, which must be a pipe.
+ *
+ * @param buffer Buffer.
+ * @param size Size of the buffer.
+ *
+ * @return 1 if it was spliced entirely, -1 if nothing was spliced because
+ *     standard output does not support it, else 0.
+ *****************************************************************************/
+static int splice_all(char *buffer, size_t size)
+{
+    int spliced_any = 0;
+    while(size > 0)
+    {
+        struct iovec iov = {buffer, size};
+        ssize_t spliced = vmsplice(STDOUT_FILENO, &iov, 1, 0);
+        if(spliced < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            return spliced_any || (errno != EBADF && errno != EINVAL) ? 0 : -1;
+        }
+        spliced_any = 1;
+        buffer += spliced;
+        size -= spliced;
+    }
+    return 1;
+}
+#endif
+
+
+/******************************************************************************
+ * Main function.
+ *****************************************************************************/
+int main(int const argc, char const *argv[])
+{
+    size_t num_of_engines = sizeof engines / sizeof *engines;
+    size_t engine = num_of_engines;
+    if(argc > 1)
+    {
+        for(engine = 0; engine < num_of_engines && strcmp(argv[1], engines[engine].name) != 0; ++engine)
+        {
+        }
+    }
+    uint64_t seed = 5489;
+    bool valid_seed = true;
+    if(engine < num_of_engines && argc > 2)
+    {
+        // Reject negative numbers, which `strtoull` would wrap around.
+        char *endptr;
+        errno = 0;
+        seed = strtoull(argv[2], &endptr, 0);
+        valid_seed = endptr != argv[2] && *endptr == '\0' && strchr(argv[2], '-') == NULL && errno != ERANGE
+            && seed <= engines[engine].seed_max;
+    }
+    if(engine == num_of_engines || !valid_seed)
+    {
+        fprintf(stderr, "Usage:\n  %s ENGINE [SEED]\n", argv[0]);
+        fprintf(stderr, "Write pseudorandom bytes to standard output. ENGINE is one of:\n");
+        for(engine = 0; engine < num_of_engines; ++engine)
+        {
+            fprintf(stderr, "  %s\n", engines[engine].name);
+        }
+        return EXIT_FAILURE;
+    }
+    engines[engine].seed(seed);
+
+    // Let writing into a pipe without a reader fail with `EPIPE` instead of
+    // killing the process. (Windows has no such signal.)
+#ifdef SIGPIPE
+    signal(SIGPIPE, SIG_IGN);
+#endif
+#ifdef _WIN32
+    _setmode(STDOUT_FILENO, _O_BINARY);
+#endif
+
+    char *buffers[2];
+    for(int i = 0; i < 2; ++i)
+    {
+#ifdef _WIN32
+        buffers[i] = _aligned_malloc(BUFFER_SIZE, PAGE_SIZE);
+#else
+        buffers[i] = aligned_alloc(PAGE_SIZE, BUFFER_SIZE);
+#endif
+        if(buffers[i] == NULL)
+        {
+            perror("aligned_alloc");
+            return EXIT_FAILURE;
+        }
+    }
+
+#ifdef __linux__
+    // Splicing is worthwhile only if the pipe can hold a whole buffer, which
+    // is also what makes it safe to refill the other buffer.
+    int use_splice = fcntl(STDOUT_FILENO, F_SETPIPE_SZ, BUFFER_SIZE) == BUFFER_SIZE;
+#endif
+    char const *failed = "write";
+    for(int i = 0;; i = 1 - i)
+    {
+        engines[engine].fill(buffers[i], BUFFER_SIZE);
+#ifdef __linux__
+        if(use_splice)
+        {
+            int result = splice_all(buffers[i], BUFFER_SIZE);
+            if(result == 1)
+            {
+                continue;
+            }
+            if(result == 0)
+            {
+                failed = "vmsplice";
+                break;
+            }
+            use_splice = 0;
+        }
+#endif
+        if(!write_all(buffers[i], BUFFER_SIZE))
+        {
+            break;
+        }
+    }
+
+    // The reader going away is the usual way for this program to stop.
+    if(errno != EPIPE)
+    {
+        perror(failed);
+        return EXIT_FAILURE;
+    }
+}